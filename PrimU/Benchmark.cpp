@@ -0,0 +1,290 @@
+// Benchmark.cpp : Headless boot benchmark. Boots the firmware without a window and stops at a
+// configurable point, then reports where the time went.
+//
+
+
+#include "stdafx.h"
+#include "executable.h"
+#include "executor.h"
+#include "ThreadHandler.h"
+#include "SystemAPI.h"
+#include "MemoryManager.h"
+#include "LCD.h"
+#include "GuestClock.h"
+#include "Profiler.h"
+#include "BlockHistogram.h"
+#include "Symbols.h"
+#include "Snapshot.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+static void PrintUsage(const char* name)
+{
+    printf("Usage: %s armfir.elf [options]\n", name);
+    printf("    --stop-pc=ADDR       stop when the guest reaches ADDR\n");
+    printf("    --stop-syscall=ID    stop when system call ID (e.g. 0x1003B) is dispatched\n");
+    printf("    --stop-stable=MS     stop once the framebuffer has changed and then stayed the same for MS (default 2000)\n");
+    printf("    --timeout=MS         give up after MS of wall time (default 120000)\n");
+    printf("    --restore=FILE       start from a machine snapshot instead of booting\n");
+    printf("    --save-snapshot=FILE save a machine snapshot to FILE once stopped\n");
+    printf("    --repeat=N           with --restore, run N times, restoring the snapshot before each run after the first\n");
+    printf("    --count-instructions count guest instructions with --preempt=timer too, at the cost of a callback per block\n");
+    printf("    --preempt=count|timer, --clock=real|virtual, --turbo, --profile=FILE, --profile-interval=US, --symbols=FILE, --block-histogram[=N],\n");
+    printf("    --heap-check=off|freed|sampled|full, --heap-check-interval=MS    as for PrimU\n");
+}
+
+// The LCD is created on the emulator thread by the guest's first LCD call, so only peek at it here
+static const void* PeekFrameBuffer()
+{
+    LCDHandler* handler = LCDHandler::PeekInstance();
+    return handler ? handler->GetFrameBuffer() : nullptr;
+}
+
+static uint64_t HashFrameBuffer(const void* frameBuffer)
+{
+    // FNV-1a; the framebuffer is written by the guest while we read it, a torn frame only delays the stop
+    const uint8_t* data = static_cast<const uint8_t*>(frameBuffer);
+
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < LCDHandler::GetFrameBufferSize(); i++)
+        hash = (hash ^ data[i]) * 0x100000001b3ull;
+    return hash;
+}
+
+static bool ParseNumber(const char* arg, const char* prefix, uint32_t* out)
+{
+    size_t len = strlen(prefix);
+    if (strncmp(arg, prefix, len) != 0)
+        return false;
+    *out = static_cast<uint32_t>(strtoul(arg + len, nullptr, 0));
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    using namespace std::chrono;
+
+    uint32_t stopPc = 0, stopSyscall = 0, stableMs = 2000, timeoutMs = 120000;
+    bool hasStopPc = false, hasStopSyscall = false;
+    std::string profilePath;
+    uint32_t profileInterval = 1000;
+    uint32_t histogramBlocks = 0;
+    uint32_t repeats = 1;
+    bool countInstructions = false;
+    std::string restorePath, snapshotPath;
+
+    if (argc < 2)
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    for (int i = 2; i < argc; i++)
+    {
+        if (ParseNumber(argv[i], "--stop-pc=", &stopPc))
+            hasStopPc = true;
+        else if (ParseNumber(argv[i], "--stop-syscall=", &stopSyscall))
+            hasStopSyscall = true;
+        else if (ParseNumber(argv[i], "--stop-stable=", &stableMs) || ParseNumber(argv[i], "--timeout=", &timeoutMs)
+            || ParseNumber(argv[i], "--profile-interval=", &profileInterval) || ParseNumber(argv[i], "--block-histogram=", &histogramBlocks)
+            || ParseNumber(argv[i], "--repeat=", &repeats))
+            ;
+        else if (strcmp(argv[i], "--block-histogram") == 0)
+            histogramBlocks = 20;
+        else if (strcmp(argv[i], "--count-instructions") == 0)
+            countInstructions = true;
+        else if (strncmp(argv[i], "--profile=", 10) == 0)
+            profilePath = argv[i] + 10;
+        else if (strncmp(argv[i], "--restore=", 10) == 0)
+            restorePath = argv[i] + 10;
+        else if (strncmp(argv[i], "--save-snapshot=", 16) == 0)
+            snapshotPath = argv[i] + 16;
+        else if (strncmp(argv[i], "--symbols=", 10) == 0)
+        {
+            if (!sSymbols->LoadMapFile(argv[i] + 10))
+                printf("Cannot read symbol map %s\n", argv[i] + 10);
+        }
+        else if (strcmp(argv[i], "--preempt=count") == 0)
+            sExecutor->SetPreemptionMode(PREEMPT_INSTRUCTION_COUNT);
+        else if (strcmp(argv[i], "--preempt=timer") == 0)
+            sExecutor->SetPreemptionMode(PREEMPT_HOST_TIMER);
+        else if (strcmp(argv[i], "--clock=real") == 0)
+            GuestClock::SetMode(GuestClock::GUEST_CLOCK_REALTIME);
+        else if (strcmp(argv[i], "--clock=virtual") == 0)
+            GuestClock::SetMode(GuestClock::GUEST_CLOCK_VIRTUAL);
+        else if (strcmp(argv[i], "--turbo") == 0)
+            sThreadHandler->SetTurbo(true);
+        else if (strcmp(argv[i], "--heap-check=off") == 0)
+            MemoryManager::SetHeapCheck(HEAP_CHECK_OFF);
+        else if (strcmp(argv[i], "--heap-check=freed") == 0)
+            MemoryManager::SetHeapCheck(HEAP_CHECK_FREED);
+        else if (strcmp(argv[i], "--heap-check=sampled") == 0)
+            MemoryManager::SetHeapCheck(HEAP_CHECK_SAMPLED);
+        else if (strcmp(argv[i], "--heap-check=full") == 0)
+            MemoryManager::SetHeapCheck(HEAP_CHECK_FULL);
+        else if (strncmp(argv[i], "--heap-check-interval=", 22) == 0)
+            MemoryManager::SetHeapCheckInterval(static_cast<uint32_t>(strtoul(argv[i] + 22, nullptr, 0)));
+        else
+        {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (repeats == 0 || (repeats > 1 && restorePath.empty()))
+    {
+        printf("--repeat needs a count of at least 1 and --restore\n");
+        return 1;
+    }
+
+    LCDHandler::SetHeadless(true);
+
+    Executable exec(argv[1]);
+
+    if (exec.get_state() == EXEC_LOAD_FAILED)
+    {
+        printf("Failed to load executable");
+        return 1;
+    }
+
+    if (!sExecutor->Initialize(&exec))
+    {
+        printf("Initializing VM failed. Returned:%i", sExecutor->GetLastError());
+        return 1;
+    }
+
+    if (!restorePath.empty() && !RestoreSnapshot(restorePath))
+    {
+        sExecutor->Cleanup();
+        return 1;
+    }
+
+    if (hasStopPc)
+        sExecutor->SetStopAddress(stopPc);
+    if (hasStopSyscall)
+        sExecutor->SetStopSyscall(stopSyscall);
+
+    // Polls the framebuffer: the stable-frame condition only applies once the boot has drawn something
+    const char* reason = "guest exited";
+    std::atomic<bool> done = false;
+    auto start = steady_clock::now();
+    auto lastChange = start;
+
+    auto watch = [&]() {
+        uint64_t initialHash = 0, lastHash = 0;
+        bool haveInitial = false;
+
+        while (!done)
+        {
+            std::this_thread::sleep_for(milliseconds(100));
+            auto now = steady_clock::now();
+
+            const void* frameBuffer = PeekFrameBuffer();
+            if (!frameBuffer)
+                ;
+            else if (!haveInitial) {
+                initialHash = lastHash = HashFrameBuffer(frameBuffer);
+                haveInitial = true;
+            }
+            else if (uint64_t hash = HashFrameBuffer(frameBuffer); hash != lastHash) {
+                lastHash = hash;
+                lastChange = now;
+            }
+
+            if (haveInitial && lastHash != initialHash && now - lastChange >= milliseconds(stableMs)) {
+                reason = "framebuffer stable";
+                sExecutor->RequestStop();
+                break;
+            }
+            if (now - start >= milliseconds(timeoutMs)) {
+                reason = "timeout";
+                sExecutor->RequestStop();
+                break;
+            }
+        }
+    };
+
+    if (!profilePath.empty())
+        sProfiler->Start(profileInterval, profilePath);
+    if (histogramBlocks)
+        sBlockHistogram->Attach(sExecutor->GetUcInstance(), histogramBlocks);
+    // Off by default: under timer preemption the count hook would slow down what is being measured
+    sExecutor->SetCountInstructions(countInstructions);
+
+    // Counters and tables accumulate over every run, so the summary reports the summed time with them;
+    // each run's own share is printed as it finishes
+    auto end = start;
+    duration<double> totalTime(0);
+    for (uint32_t run = 0; run < repeats; run++)
+    {
+        // Later runs reset the machine from inside the executor, which only copies back the pages
+        // the previous run wrote; the time this takes is part of the run
+        if (run > 0) {
+            sExecutor->ClearStopRequest();
+            sExecutor->RequestRestore(restorePath);
+        }
+
+        uint64_t runInstructions = sExecutor->GetExecutedInstructions();
+        uint64_t runCalls = sSystemAPI->GetCallCount();
+        uint64_t runSwitches = sThreadHandler->GetSwitchCount();
+
+        reason = "guest exited";
+        done = false;
+        start = lastChange = steady_clock::now();
+        std::thread watcher(watch);
+
+        sExecutor->Execute();
+        end = steady_clock::now();
+
+        done = true;
+        watcher.join();
+        if (strcmp(reason, "guest exited") == 0 && sExecutor->IsStopRequested())
+            reason = "stop pc / syscall reached";
+        totalTime += end - start;
+        if (repeats > 1) {
+            printf("run %u: %.3f s, %s, ", run + 1, duration<double>(end - start).count(), reason);
+            if (sExecutor->IsCountingInstructions())
+                printf("%llu instructions, ", sExecutor->GetExecutedInstructions() - runInstructions);
+            printf("%llu syscalls, %llu context switches\n", sSystemAPI->GetCallCount() - runCalls,
+                sThreadHandler->GetSwitchCount() - runSwitches);
+        }
+    }
+    sProfiler->Stop();
+
+    printf("\n== Boot benchmark ==\n");
+    if (repeats > 1) {
+        printf("runs:               %u, totals below\n", repeats);
+        printf("last stop reason:   %s\n", reason);
+    }
+    else {
+        printf("stop reason:        %s\n", reason);
+    }
+    printf("wall time:          %.3f s\n", totalTime.count());
+    if (repeats == 1)
+        printf("last frame change:  %.3f s\n", duration<double>(lastChange - start).count());
+    if (sExecutor->IsCountingInstructions())
+        printf("guest instructions: %llu\n", sExecutor->GetExecutedInstructions());
+    else
+        printf("guest instructions: n/a with --preempt=timer, see --count-instructions\n");
+    printf("syscalls:           %llu\n", sSystemAPI->GetCallCount());
+    printf("context switches:   %llu\n", sThreadHandler->GetSwitchCount());
+    printf("peak heap:          %zu bytes\n", sMemoryManager->GetHeapPeak());
+    printf("heap trimmed:       %zu bytes\n", sMemoryManager->GetHeapTrimmed());
+    sSystemAPI->DumpStats(stdout);
+    sMemoryManager->DumpHeapStats(stdout);
+    sBlockHistogram->Dump(stdout);
+    sBlockHistogram->Detach();
+    sProfiler->Flush();
+
+    if (!snapshotPath.empty())
+        SaveSnapshot(snapshotPath);
+
+    sExecutor->Cleanup();
+
+    return 0;
+}
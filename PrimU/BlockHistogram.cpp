@@ -0,0 +1,117 @@
+#include "BlockHistogram.h"
+#include "Symbols.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <capstone/capstone.h>
+
+BlockHistogram* BlockHistogram::_instance = nullptr;
+
+void block_hook(uc_engine* uc, uint64_t address, uint32_t size, void* user_data)
+{
+    static_cast<BlockHistogram*>(user_data)->Record(uc, static_cast<uint32_t>(address), size);
+}
+
+void BlockHistogram::Attach(uc_engine* uc, size_t topBlocks)
+{
+    if (_hook || !uc)
+        return;
+
+    if (_table.empty())
+        _table.resize(INITIAL_CAPACITY);
+    _uc = uc;
+    _top = topBlocks;
+    // begin > end hooks every block
+    uc_hook_add(uc, &_hook, UC_HOOK_BLOCK, block_hook, this, 1, 0);
+}
+
+void BlockHistogram::Detach()
+{
+    if (!_hook)
+        return;
+
+    uc_hook_del(_uc, _hook);
+    _hook = 0;
+}
+
+void BlockHistogram::Insert(uc_engine* uc, Entry& slot, uint32_t key, uint32_t size)
+{
+    // First execution of this block: the one time the mode is read, for disassembly later
+    uint32_t cpsr = 0;
+    uc_reg_read(uc, UC_ARM_REG_CPSR, &cpsr);
+
+    slot.size = size;
+    slot.count = 1;
+    slot.thumb = (cpsr & CPSR_THUMB) != 0;
+    slot.key = key;
+
+    // Keep the load factor under 3/4 so probe sequences stay short
+    if (++_used * 4 > _table.size() * 3)
+        Grow();
+}
+
+void BlockHistogram::Grow()
+{
+    std::vector<Entry> bigger(_table.size() * 2);
+    size_t mask = bigger.size() - 1;
+    for (const Entry& entry : _table) {
+        if (!entry.key)
+            continue;
+        size_t i = Hash(entry.key) & mask;
+        while (bigger[i].key)
+            i = (i + 1) & mask;
+        bigger[i] = entry;
+    }
+    _table.swap(bigger);
+}
+
+void BlockHistogram::Dump(FILE* out) const
+{
+    if (!_hook)
+        return;
+
+    std::vector<Entry> entries;
+    for (const Entry& entry : _table) {
+        if (entry.key)
+            entries.push_back(entry);
+    }
+    if (entries.empty())
+        return;
+
+    uint64_t total = 0;
+    for (const Entry& entry : entries)
+        total += entry.count;
+
+    size_t top = std::min(_top, entries.size());
+    std::partial_sort(entries.begin(), entries.begin() + top, entries.end(),
+        [](const Entry& a, const Entry& b) { return a.count > b.count; });
+
+    csh arm = 0, thumb = 0;
+    bool haveArm = cs_open(CS_ARCH_ARM, CS_MODE_ARM, &arm) == CS_ERR_OK;
+    bool haveThumb = cs_open(CS_ARCH_ARM, CS_MODE_THUMB, &thumb) == CS_ERR_OK;
+
+    fprintf(out, "\n--- Hottest blocks (%zu distinct, %llu executions) ---\n", entries.size(), total);
+    for (size_t n = 0; n < top; n++) {
+        const Entry& entry = entries[n];
+        uint32_t addr = entry.key & ~1u;
+        fprintf(out, "\n#%zu  %llu (%.2f%%)  0x%08X %s  %s\n", n + 1, entry.count, 100.0 * entry.count / total,
+            addr, entry.thumb ? "T" : "A", sSymbols->Describe(addr).c_str());
+
+        std::vector<uint8_t> code(entry.size);
+        bool haveCs = entry.thumb ? haveThumb : haveArm;
+        if (!haveCs || code.empty() || uc_mem_read(_uc, addr, code.data(), code.size()) != UC_ERR_OK)
+            continue;
+
+        cs_insn* insn = nullptr;
+        size_t count = cs_disasm(entry.thumb ? thumb : arm, code.data(), code.size(), addr, 0, &insn);
+        for (size_t i = 0; i < count; i++)
+            fprintf(out, "    0x%08" PRIx64 ":\t%s\t%s\n", insn[i].address, insn[i].mnemonic, insn[i].op_str);
+        if (count)
+            cs_free(insn, count);
+    }
+
+    if (haveArm)
+        cs_close(&arm);
+    if (haveThumb)
+        cs_close(&thumb);
+}
@@ -0,0 +1,78 @@
+#ifndef BLOCKHISTOGRAM_H
+#define BLOCKHISTOGRAM_H
+
+#include "common.h"
+
+#include <unicorn/unicorn.h>
+
+#include <cstdio>
+#include <vector>
+
+// Opt-in execution count per translated basic block, to find firmware routines worth replacing
+// with HLE handlers. Nothing is hooked until Attach, so a normal run pays nothing.
+class BlockHistogram
+{
+public:
+    static BlockHistogram* GetInstance() { return !_instance ? _instance = new BlockHistogram : _instance; }
+
+    // `topBlocks` is how many blocks Dump prints
+    void Attach(uc_engine* uc, size_t topBlocks);
+    void Detach();
+    bool IsAttached() const { return _hook != 0; }
+
+    // Prints the most executed blocks with their disassembly; does nothing unless attached. The
+    // table and guest code belong to the emulator thread: call this from it between slices (see
+    // Executor::RequestStats) or once Execute has returned.
+    void Dump(FILE* out) const;
+
+    friend void block_hook(uc_engine* uc, uint64_t address, uint32_t size, void* user_data);
+
+private:
+    BlockHistogram() {}
+    BlockHistogram(BlockHistogram const&) = delete;
+    void operator=(BlockHistogram const&) = delete;
+    static BlockHistogram* _instance;
+
+    // Block addresses are at least 2-byte aligned, so an entry's key is the address with bit 0 set
+    // and 0 marks an empty slot
+    struct Entry
+    {
+        uint32_t key;
+        uint32_t size;
+        uint64_t count;
+        bool thumb;
+    };
+
+    static constexpr size_t INITIAL_CAPACITY = 1 << 14;
+
+    static size_t Hash(uint32_t key) { return (key * 0x9E3779B1u) >> 7; }
+
+    void Record(uc_engine* uc, uint32_t address, uint32_t size)
+    {
+        uint32_t key = address | 1u;
+        size_t mask = _table.size() - 1;
+        for (size_t i = Hash(key) & mask;; i = (i + 1) & mask) {
+            Entry& entry = _table[i];
+            if (entry.key == key) {
+                entry.count++;
+                return;
+            }
+            if (entry.key == 0) {
+                Insert(uc, entry, key, size);
+                return;
+            }
+        }
+    }
+    void Insert(uc_engine* uc, Entry& slot, uint32_t key, uint32_t size);
+    void Grow();
+
+    uc_engine* _uc = nullptr;
+    uc_hook _hook = 0;
+    size_t _top = 0;
+    std::vector<Entry> _table;
+    size_t _used = 0;
+};
+
+#define sBlockHistogram BlockHistogram::GetInstance()
+
+#endif
@@ -0,0 +1,57 @@
+#include "GuestClock.h"
+
+#include <atomic>
+
+namespace
+{
+    std::atomic<GuestClock::Mode> s_mode{ GuestClock::GUEST_CLOCK_REALTIME };
+
+    const std::chrono::steady_clock::time_point s_hostEpoch = std::chrono::steady_clock::now();
+    const std::chrono::system_clock::time_point s_wallEpoch = std::chrono::system_clock::now();
+
+    // Realtime: jumps added on top of host time. Virtual: the whole guest time.
+    std::atomic<GuestClock::rep> s_offset{ 0 };
+}
+
+GuestClock::time_point GuestClock::now()
+{
+    rep ticks = s_offset.load(std::memory_order_relaxed);
+    if (s_mode.load(std::memory_order_relaxed) == GUEST_CLOCK_REALTIME)
+        ticks += std::chrono::duration_cast<duration>(std::chrono::steady_clock::now() - s_hostEpoch).count();
+    return time_point(duration(ticks));
+}
+
+void GuestClock::SetMode(Mode mode)
+{
+    // Switching keeps the clock continuous
+    time_point current = now();
+    rep offset = current.time_since_epoch().count();
+    if (mode == GUEST_CLOCK_REALTIME)
+        offset -= std::chrono::duration_cast<duration>(std::chrono::steady_clock::now() - s_hostEpoch).count();
+
+    s_mode = mode;
+    s_offset = offset;
+}
+
+GuestClock::Mode GuestClock::GetMode()
+{
+    return s_mode.load(std::memory_order_relaxed);
+}
+
+void GuestClock::Credit(duration elapsed)
+{
+    if (IsVirtual() && elapsed.count() > 0)
+        s_offset.fetch_add(elapsed.count(), std::memory_order_relaxed);
+}
+
+void GuestClock::AdvanceTo(time_point target)
+{
+    duration ahead = target - now();
+    if (ahead.count() > 0)
+        s_offset.fetch_add(ahead.count(), std::memory_order_relaxed);
+}
+
+std::chrono::system_clock::time_point GuestClock::WallNow()
+{
+    return s_wallEpoch + std::chrono::duration_cast<std::chrono::system_clock::duration>(now().time_since_epoch());
+}
@@ -0,0 +1,44 @@
+#ifndef GUESTCLOCK_H
+#define GUESTCLOCK_H
+
+#include "common.h"
+
+#include <chrono>
+
+// Time source for everything the guest can observe: sleeps, wait timeouts, GetSysTime and
+// scheduler deadlines. Usable as a std::chrono clock.
+//
+// Realtime mode (default) follows the host steady clock. Virtual mode only moves when the
+// executor credits the guest code it ran or the scheduler jumps to the next timer deadline,
+// so with count preemption a run is independent of host speed. Both modes accept forward jumps.
+class GuestClock
+{
+public:
+    typedef std::chrono::nanoseconds duration;
+    typedef duration::rep rep;
+    typedef duration::period period;
+    typedef std::chrono::time_point<GuestClock> time_point;
+    static constexpr bool is_steady = true;
+
+    enum Mode
+    {
+        GUEST_CLOCK_REALTIME,
+        GUEST_CLOCK_VIRTUAL
+    };
+
+    static time_point now();
+
+    static void SetMode(Mode mode);
+    static Mode GetMode();
+    static bool IsVirtual() { return GetMode() == GUEST_CLOCK_VIRTUAL; }
+
+    // Virtual mode: guest code ran for this long. Ignored in realtime mode.
+    static void Credit(duration elapsed);
+    // Moves the clock forward to `target`; never moves it backwards
+    static void AdvanceTo(time_point target);
+
+    // Host calendar time at startup plus guest time elapsed since, for the guest RTC
+    static std::chrono::system_clock::time_point WallNow();
+};
+
+#endif
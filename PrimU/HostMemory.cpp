@@ -0,0 +1,436 @@
+#include "HostMemory.h"
+
+#include <windows.h>
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+namespace
+{
+    struct TrackedRange
+    {
+        RealPtr base;
+        size_t size;
+        // Reserved like the range; a page is committed the first time it is dirtied
+        RealPtr shadow;
+        // PAGE_WRITECOPY for file mappings, so written pages still become private copies
+        DWORD writable;
+        std::vector<uint8_t> dirty;
+        std::vector<uint32_t> dirtyList;
+    };
+
+    struct ReservedRange
+    {
+        RealPtr base;
+        size_t size;
+        std::vector<uint8_t> committed; // per HOST_COMMIT_CHUNK
+        // Reservations appended by Extend, released along with the range
+        std::vector<RealPtr> extensions;
+    };
+
+    // Guards both kinds of range; the fault handler takes it, so nothing that holds it may fault
+    std::mutex g_rangesMutex;
+    std::vector<TrackedRange> g_ranges;
+    std::vector<ReservedRange> g_reserved;
+    PVOID g_faultHandler = nullptr;
+
+    // File mappings by the pointer handed out, which lies inside the view when the file offset is
+    // not on the allocation granularity
+    std::map<RealPtr, PVOID> g_views;
+    std::mutex g_viewsMutex;
+
+    TrackedRange* FindRange(RealPtr addr)
+    {
+        for (TrackedRange& range : g_ranges) {
+            if (addr >= range.base && addr < range.base + range.size)
+                return &range;
+        }
+        return nullptr;
+    }
+
+    ReservedRange* FindReserved(RealPtr addr)
+    {
+        for (ReservedRange& range : g_reserved) {
+            if (addr >= range.base && addr < range.base + range.size)
+                return &range;
+        }
+        return nullptr;
+    }
+
+    bool SetWritable(const TrackedRange& range, RealPtr page, size_t size, bool writable)
+    {
+        DWORD old;
+        return VirtualProtect(page, size, writable ? range.writable : PAGE_READONLY, &old) != 0;
+    }
+
+    // VirtualProtect fails on uncommitted pages, so reserved ranges are protected chunk by chunk
+    void SetRangeWritable(const TrackedRange& range, bool writable)
+    {
+        ReservedRange* reserved = FindReserved(range.base);
+        if (!reserved) {
+            SetWritable(range, range.base, range.size, writable);
+            return;
+        }
+        for (size_t chunk = 0; chunk < reserved->committed.size(); chunk++) {
+            if (reserved->committed[chunk])
+                SetWritable(range, range.base + chunk * HOST_COMMIT_CHUNK, HOST_COMMIT_CHUNK, writable);
+        }
+    }
+
+    // Commits the chunk holding addr if it lies in a reserved range; the caller holds g_rangesMutex
+    bool CommitChunk(RealPtr addr)
+    {
+        ReservedRange* reserved = FindReserved(addr);
+        if (!reserved)
+            return true;
+        size_t chunk = static_cast<size_t>(addr - reserved->base) / HOST_COMMIT_CHUNK;
+        if (reserved->committed[chunk])
+            return true;
+
+        // Inside a tracked range the chunk starts write-protected, so its first write is recorded
+        // against a zero baseline like any other
+        RealPtr chunkBase = reserved->base + chunk * HOST_COMMIT_CHUNK;
+        TrackedRange* range = FindRange(addr);
+        if (!VirtualAlloc(chunkBase, HOST_COMMIT_CHUNK, MEM_COMMIT, range ? PAGE_READONLY : PAGE_READWRITE))
+            return false;
+        reserved->committed[chunk] = 1;
+
+        // Pages dirtied before a Decommit stay writable, as the fault handler expects
+        if (range) {
+            uint32_t firstPage = static_cast<uint32_t>((chunkBase - range->base) / PAGE_SIZE);
+            for (uint32_t page = firstPage; page < firstPage + HOST_COMMIT_CHUNK / PAGE_SIZE; page++) {
+                if (range->dirty[page])
+                    SetWritable(*range, range->base + static_cast<size_t>(page) * PAGE_SIZE, PAGE_SIZE, true);
+            }
+        }
+        return true;
+    }
+
+    // Copies the page aside and lifts its protection; the caller holds g_rangesMutex
+    void DirtyPage(TrackedRange& range, uint32_t page)
+    {
+        if (range.dirty[page])
+            return;
+
+        size_t offset = static_cast<size_t>(page) * PAGE_SIZE;
+        CommitChunk(range.base + offset);
+        VirtualAlloc(range.shadow + offset, PAGE_SIZE, MEM_COMMIT, PAGE_READWRITE);
+        memcpy(range.shadow + offset, range.base + offset, PAGE_SIZE);
+        SetWritable(range, range.base + offset, PAGE_SIZE, true);
+
+        range.dirty[page] = 1;
+        range.dirtyList.push_back(page);
+    }
+
+    LONG CALLBACK AccessFaultHandler(EXCEPTION_POINTERS* info)
+    {
+        const EXCEPTION_RECORD* record = info->ExceptionRecord;
+        // ExceptionInformation[0] is 1 for a write, [1] the address
+        if (record->ExceptionCode != EXCEPTION_ACCESS_VIOLATION || record->NumberParameters < 2)
+            return EXCEPTION_CONTINUE_SEARCH;
+
+        RealPtr addr = reinterpret_cast<RealPtr>(record->ExceptionInformation[1]);
+        std::lock_guard<std::mutex> lock(g_rangesMutex);
+        // First touch of a reserved chunk; a tracked write then faults once more and is recorded below
+        ReservedRange* reserved = FindReserved(addr);
+        if (reserved && !reserved->committed[static_cast<size_t>(addr - reserved->base) / HOST_COMMIT_CHUNK])
+            return CommitChunk(addr) ? EXCEPTION_CONTINUE_EXECUTION : EXCEPTION_CONTINUE_SEARCH;
+
+        if (record->ExceptionInformation[0] != 1)
+            return EXCEPTION_CONTINUE_SEARCH;
+        TrackedRange* range = FindRange(addr);
+        if (!range)
+            return EXCEPTION_CONTINUE_SEARCH;
+
+        uint32_t page = static_cast<uint32_t>((addr - range->base) / PAGE_SIZE);
+        if (range->dirty[page])
+            // Already writable; not our fault
+            return EXCEPTION_CONTINUE_SEARCH;
+        DirtyPage(*range, page);
+        return EXCEPTION_CONTINUE_EXECUTION;
+    }
+
+    // The caller holds g_rangesMutex
+    void InstallFaultHandler()
+    {
+        if (!g_faultHandler)
+            g_faultHandler = AddVectoredExceptionHandler(1, AccessFaultHandler);
+    }
+}
+
+RealPtr HostMemory::Allocate(size_t size)
+{
+    return static_cast<RealPtr>(VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+}
+
+RealPtr HostMemory::Reserve(size_t size)
+{
+    RealPtr memory = static_cast<RealPtr>(VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS));
+    if (!memory)
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(g_rangesMutex);
+    InstallFaultHandler();
+    ReservedRange range;
+    range.base = memory;
+    range.size = size;
+    range.committed.assign(size / HOST_COMMIT_CHUNK, 0);
+    g_reserved.push_back(std::move(range));
+    return memory;
+}
+
+bool HostMemory::Extend(RealPtr memory, size_t size)
+{
+    std::lock_guard<std::mutex> lock(g_rangesMutex);
+    ReservedRange* reserved = FindReserved(memory);
+    if (!reserved || reserved->base != memory)
+        return false;
+    if (size <= reserved->size)
+        return true;
+
+    RealPtr tail = reserved->base + reserved->size;
+    if (VirtualAlloc(tail, size - reserved->size, MEM_RESERVE, PAGE_NOACCESS) != tail)
+        return false;
+    reserved->extensions.push_back(tail);
+    reserved->size = size;
+    reserved->committed.resize(size / HOST_COMMIT_CHUNK, 0);
+    return true;
+}
+
+bool HostMemory::Commit(RealPtr memory, size_t size)
+{
+    if (!size)
+        return true;
+
+    std::lock_guard<std::mutex> lock(g_rangesMutex);
+    ReservedRange* reserved = FindReserved(memory);
+    if (!reserved)
+        return true;
+    size_t first = static_cast<size_t>(memory - reserved->base) / HOST_COMMIT_CHUNK;
+    size_t last = (std::min)(static_cast<size_t>(memory + size - 1 - reserved->base), reserved->size - 1) / HOST_COMMIT_CHUNK;
+    for (size_t chunk = first; chunk <= last; chunk++) {
+        if (!CommitChunk(reserved->base + chunk * HOST_COMMIT_CHUNK))
+            return false;
+    }
+    return true;
+}
+
+bool HostMemory::IsCommitted(RealPtr memory)
+{
+    std::lock_guard<std::mutex> lock(g_rangesMutex);
+    ReservedRange* reserved = FindReserved(memory);
+    return !reserved || reserved->committed[static_cast<size_t>(memory - reserved->base) / HOST_COMMIT_CHUNK];
+}
+
+size_t HostMemory::Decommit(RealPtr memory, size_t size)
+{
+    std::lock_guard<std::mutex> lock(g_rangesMutex);
+    ReservedRange* reserved = FindReserved(memory);
+    if (!reserved)
+        return 0;
+    size_t offset = static_cast<size_t>(memory - reserved->base);
+    size_t first = (offset + HOST_COMMIT_CHUNK - 1) / HOST_COMMIT_CHUNK;
+    size_t end = (std::min)(offset + size, reserved->size) / HOST_COMMIT_CHUNK;
+
+    size_t released = 0;
+    for (size_t chunk = first; chunk < end; chunk++) {
+        if (!reserved->committed[chunk])
+            continue;
+        RealPtr chunkBase = reserved->base + chunk * HOST_COMMIT_CHUNK;
+        if (TrackedRange* range = FindRange(chunkBase)) {
+            uint32_t firstPage = static_cast<uint32_t>((chunkBase - range->base) / PAGE_SIZE);
+            for (uint32_t page = firstPage; page < firstPage + HOST_COMMIT_CHUNK / PAGE_SIZE; page++)
+                DirtyPage(*range, page);
+        }
+        if (!VirtualFree(chunkBase, HOST_COMMIT_CHUNK, MEM_DECOMMIT))
+            continue;
+        reserved->committed[chunk] = 0;
+        released += HOST_COMMIT_CHUNK;
+    }
+    return released;
+}
+
+RealPtr HostMemory::MapFile(const std::string& path, uint64_t offset, size_t size)
+{
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    // A view of a read-only file cannot reach past its end
+    LARGE_INTEGER fileSize;
+    if (!size || !GetFileSizeEx(file, &fileSize) || offset + size > static_cast<uint64_t>(fileSize.QuadPart)) {
+        CloseHandle(file);
+        return nullptr;
+    }
+
+    // Both handles can go once the view exists; it keeps the file open
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping)
+        return nullptr;
+
+    // Views start on the allocation granularity (64KB), file offsets only need to be page aligned
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    uint64_t viewOffset = offset - offset % info.dwAllocationGranularity;
+    size_t skew = static_cast<size_t>(offset - viewOffset);
+    PVOID view = MapViewOfFile(mapping, FILE_MAP_COPY, static_cast<DWORD>(viewOffset >> 32), static_cast<DWORD>(viewOffset), skew + size);
+    CloseHandle(mapping);
+    if (!view)
+        return nullptr;
+
+    RealPtr memory = static_cast<RealPtr>(view) + skew;
+    // The rest of the last page is the file's next bytes; written once, so one page is copied
+    size_t tail = size % PAGE_SIZE;
+    if (tail && offset + size < static_cast<uint64_t>(fileSize.QuadPart))
+        memset(memory + size, 0, PAGE_SIZE - tail);
+
+    std::lock_guard<std::mutex> lock(g_viewsMutex);
+    g_views[memory] = view;
+    return memory;
+}
+
+void HostMemory::Free(RealPtr memory)
+{
+    if (!memory)
+        return;
+    Untrack(memory);
+
+    PVOID view = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(g_viewsMutex);
+        auto it = g_views.find(memory);
+        if (it != g_views.end()) {
+            view = it->second;
+            g_views.erase(it);
+        }
+    }
+    if (view) {
+        UnmapViewOfFile(view);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(g_rangesMutex);
+        auto it = std::find_if(g_reserved.begin(), g_reserved.end(), [memory](const ReservedRange& range) { return range.base == memory; });
+        if (it != g_reserved.end()) {
+            for (RealPtr extension : it->extensions)
+                VirtualFree(extension, 0, MEM_RELEASE);
+            g_reserved.erase(it);
+        }
+    }
+    VirtualFree(memory, 0, MEM_RELEASE);
+}
+
+void HostMemory::Track(RealPtr memory, size_t size)
+{
+    bool fileMapped;
+    {
+        std::lock_guard<std::mutex> lock(g_viewsMutex);
+        fileMapped = g_views.count(memory) != 0;
+    }
+
+    std::lock_guard<std::mutex> lock(g_rangesMutex);
+    if (FindRange(memory))
+        return;
+
+    RealPtr shadow = static_cast<RealPtr>(VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS));
+    if (!shadow)
+        return;
+
+    InstallFaultHandler();
+
+    TrackedRange range;
+    range.base = memory;
+    range.size = size;
+    range.shadow = shadow;
+    range.writable = fileMapped ? PAGE_WRITECOPY : PAGE_READWRITE;
+    range.dirty.assign(size / PAGE_SIZE, 0);
+    SetRangeWritable(range, false);
+    g_ranges.push_back(std::move(range));
+}
+
+void HostMemory::Untrack(RealPtr memory)
+{
+    std::lock_guard<std::mutex> lock(g_rangesMutex);
+    auto it = std::find_if(g_ranges.begin(), g_ranges.end(), [memory](const TrackedRange& range) { return range.base == memory; });
+    if (it == g_ranges.end())
+        return;
+
+    SetRangeWritable(*it, true);
+    VirtualFree(it->shadow, 0, MEM_RELEASE);
+    g_ranges.erase(it);
+}
+
+bool HostMemory::IsTracked(RealPtr memory)
+{
+    std::lock_guard<std::mutex> lock(g_rangesMutex);
+    TrackedRange* range = FindRange(memory);
+    return range && range->base == memory;
+}
+
+void HostMemory::ClearDirty()
+{
+    std::lock_guard<std::mutex> lock(g_rangesMutex);
+    for (TrackedRange& range : g_ranges) {
+        // Shadow pages stay committed for the next round
+        for (uint32_t page : range.dirtyList) {
+            range.dirty[page] = 0;
+            SetWritable(range, range.base + static_cast<size_t>(page) * PAGE_SIZE, PAGE_SIZE, false);
+        }
+        range.dirtyList.clear();
+    }
+}
+
+size_t HostMemory::Revert()
+{
+    std::lock_guard<std::mutex> lock(g_rangesMutex);
+    size_t reverted = 0;
+    for (TrackedRange& range : g_ranges) {
+        for (uint32_t page : range.dirtyList) {
+            size_t offset = static_cast<size_t>(page) * PAGE_SIZE;
+            // Decommitted since it was dirtied; committing lifts the protection again
+            CommitChunk(range.base + offset);
+            memcpy(range.base + offset, range.shadow + offset, PAGE_SIZE);
+            SetWritable(range, range.base + offset, PAGE_SIZE, false);
+            range.dirty[page] = 0;
+        }
+        reverted += range.dirtyList.size();
+        range.dirtyList.clear();
+    }
+    return reverted;
+}
+
+std::vector<uint32_t> HostMemory::GetDirtyPages(RealPtr memory)
+{
+    std::lock_guard<std::mutex> lock(g_rangesMutex);
+    TrackedRange* range = FindRange(memory);
+    if (!range)
+        return {};
+
+    std::vector<uint32_t> pages = range->dirtyList;
+    std::sort(pages.begin(), pages.end());
+    return pages;
+}
+
+void HostMemory::PrepareWrite(RealPtr memory, size_t size)
+{
+    if (!size)
+        return;
+
+    std::lock_guard<std::mutex> lock(g_rangesMutex);
+    RealPtr end = memory + size;
+    for (RealPtr addr = memory; addr < end;) {
+        TrackedRange* range = FindRange(addr);
+        if (!range) {
+            CommitChunk(addr);
+            addr = reinterpret_cast<RealPtr>((reinterpret_cast<uintptr_t>(addr) | (PAGE_SIZE - 1)) + 1);
+            continue;
+        }
+        uint32_t page = static_cast<uint32_t>((addr - range->base) / PAGE_SIZE);
+        DirtyPage(*range, page);
+        addr = range->base + static_cast<size_t>(page + 1) * PAGE_SIZE;
+    }
+}
@@ -0,0 +1,65 @@
+#ifndef HOSTMEMORY_H
+#define HOSTMEMORY_H
+
+#include "common.h"
+
+#include <string>
+#include <vector>
+
+// Granularity of demand-committed memory (Reserve)
+constexpr size_t HOST_COMMIT_CHUNK = 0x10000;
+
+// Host memory behind guest mappings (uc_mem_map_ptr). Allocations are page aligned and zeroed,
+// so whole pages can be protected, shared or released. File mappings are copy-on-write: pages
+// stay shared with the OS file cache, and with other emulator processes, until written.
+// Reserved ranges only take address space: each HOST_COMMIT_CHUNK is committed when first used,
+// through Commit or a host access fault, so large sparse regions cost only what is touched.
+//
+// Write tracking: Track write-protects a range; the first write to each page afterwards faults,
+// the page's contents are copied aside to a shadow, the page is marked dirty and the write goes
+// through. Any writer is caught this way: translated guest code, Unicorn and HLE handlers alike.
+// Guest memory is only written on the emulator thread, which is also where tracking changes.
+class HostMemory
+{
+public:
+    static RealPtr Allocate(size_t size);
+    // Reserves a range whose chunks are committed, zeroed, on first use; size is a multiple of
+    // HOST_COMMIT_CHUNK
+    static RealPtr Reserve(size_t size);
+    // Grows the reserved range starting at `memory` to `size` in place; fails if the address space
+    // right after it is taken. size is a multiple of HOST_COMMIT_CHUNK.
+    static bool Extend(RealPtr memory, size_t size);
+    // Commits the chunks covering [memory, memory + size) of a reserved range; true elsewhere
+    static bool Commit(RealPtr memory, size_t size);
+    // False only inside a reserved chunk that is not committed, which reads as zero
+    static bool IsCommitted(RealPtr memory);
+    // Decommits the whole chunks inside [memory, memory + size) of a reserved range; they read as
+    // zero again. Tracked contents are kept in the shadow, so Revert still restores them. Returns
+    // the bytes given back.
+    static size_t Decommit(RealPtr memory, size_t size);
+    // Maps [offset, offset + size) of the file; offset is a multiple of PAGE_SIZE and the range
+    // lies within the file. The last page reads as zero past the end of the file, but not past
+    // `size` if the file goes on. Returns nullptr if the file cannot be mapped.
+    static RealPtr MapFile(const std::string& path, uint64_t offset, size_t size);
+    // Releases an allocation or a file mapping
+    static void Free(RealPtr memory);
+
+    // Starts tracking [memory, memory + size) with every page clean; size is a multiple of PAGE_SIZE
+    static void Track(RealPtr memory, size_t size);
+    static void Untrack(RealPtr memory);
+    static bool IsTracked(RealPtr memory);
+
+    // Makes every tracked page clean again: the current contents become the new shadow reference
+    static void ClearDirty();
+    // Copies every dirty page back from its shadow and makes it clean; returns the pages copied
+    static size_t Revert();
+    // Dirty pages of the range starting at `memory`, as ascending page indices
+    static std::vector<uint32_t> GetDirtyPages(RealPtr memory);
+
+    // Dirties the pages ahead of a write that cannot fault, i.e. one the OS makes (ReadFile into
+    // a guest buffer fails instead of faulting on a protected or uncommitted page); also commits
+    // reserved chunks
+    static void PrepareWrite(RealPtr memory, size_t size);
+};
+
+#endif
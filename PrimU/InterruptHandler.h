@@ -5,6 +5,8 @@
 #include "interrupts.h"
 #include "executor.h"
 
+#include <cstddef>
+
 
 enum HandleStatus
 {
@@ -13,11 +15,20 @@ enum HandleStatus
     HANDLE_UNKOWN
 };
 
+// Call site of an SVC: the guest stack pointer as seen by the stub (stacked LR at [sp], stack
+// arguments from sp + 8). Registers are left in Unicorn until a handler asks for them.
+struct SystemCallFrame
+{
+    uc_engine* uc;
+    uint32_t sp;
+};
+
+// Register snapshot for handlers that decode their own arguments
 struct SystemServiceArguments
 {
-    SystemServiceArguments()
+    SystemServiceArguments(const SystemCallFrame& frame) : sp(frame.sp)
     {
-        uc_reg_read_batch(sExecutor->GetUcInstance(), (int*)_regs, (void**)_args, 6);
+        uc_reg_read_batch(frame.uc, (int*)_regs, (void**)_args, 5);
     }
     uint32_t r0;
     uint32_t r1;
@@ -26,35 +37,38 @@ struct SystemServiceArguments
     uint32_t r4;
     uint32_t sp;
 private:
-    uc_arm_reg _regs[6] =
+    uc_arm_reg _regs[5] =
     {
         UC_ARM_REG_R0,
         UC_ARM_REG_R1,
         UC_ARM_REG_R2,
         UC_ARM_REG_R3,
-        UC_ARM_REG_R4,
-        UC_ARM_REG_SP
+        UC_ARM_REG_R4
     };
 
-    uint32_t* _args[6] =
+    uint32_t* _args[5] =
     {
         &r0,
         &r1,
         &r2,
         &r3,
-        &r4,
-        &sp
+        &r4
     };
 };
 
 typedef uint32_t(*Handler)(SystemServiceArguments* args);
+// Typed handlers wrapped by Bind<> (SystemCallBinding.h) fetch only the arguments they declare
+typedef uint32_t(*BoundHandler)(const SystemCallFrame& frame);
 
 struct InterruptHandler
 {
-    InterruptHandler(InterruptID id, HandleStatus status, Handler callback, const char* name) : Id(id), Status(status), Callback(callback), Name(name) { }
+    constexpr InterruptHandler(InterruptID id, HandleStatus status, Handler callback, const char* name) : Id(id), Status(status), Callback(callback), Bound(nullptr), Name(name) { }
+    constexpr InterruptHandler(InterruptID id, HandleStatus status, BoundHandler bound, const char* name) : Id(id), Status(status), Callback(nullptr), Bound(bound), Name(name) { }
+    constexpr InterruptHandler(InterruptID id, HandleStatus status, std::nullptr_t, const char* name) : Id(id), Status(status), Callback(nullptr), Bound(nullptr), Name(name) { }
     InterruptID Id;
     HandleStatus Status;
     Handler Callback;
+    BoundHandler Bound;
     const char* Name;
 };
 
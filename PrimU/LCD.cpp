@@ -2,6 +2,7 @@
 // --- Include your project header ---
 #include "LCD.h"
 #include "ui.h"
+#include "Snapshot.h"
 // --- Standard Library and Win32 Headers ---
 #include <windows.h>
 #include <thread>
@@ -88,11 +89,58 @@ std::map<int, int> vk_to_device_keymap = {
 // --- LCDHandler Implementation (from your code) ---
 
 LCDHandler* LCDHandler::_instance = nullptr;
+bool LCDHandler::_headless = false;
 
 LCDHandler::LCDHandler() {
 	InitActiveLCD();
 }
 
+LCDHandler::LCDHandler(VirtPtr lcd, VirtPtr activeLCDPtr) : _activeLCDPtr(activeLCDPtr) {
+	_activeLCD = reinterpret_cast<LCD*>(sMemoryManager->GetRealAddr(lcd));
+	if (!IsHeadless())
+		_activeLCD->OpenWindow();
+}
+
+void LCDHandler::SaveSnapshot(SnapshotWriter& writer) {
+	LCDHandler* handler = PeekInstance();
+	writer.Write<uint8_t>(handler != nullptr);
+	if (!handler)
+		return;
+	writer.Write<uint32_t>(sMemoryManager->GetVirtualAddr(reinterpret_cast<RealPtr>(handler->_activeLCD)));
+	writer.Write<uint32_t>(handler->_activeLCDPtr);
+	writer.Write<uint16_t>(handler->brightness_level);
+}
+
+void LCDHandler::RestoreSnapshot(SnapshotReader& reader) {
+	if (!reader.Read<uint8_t>()) {
+		if (_instance)
+			reader.Fail("snapshot was taken before the LCD was created");
+		return;
+	}
+	VirtPtr lcd = reader.Read<uint32_t>();
+	VirtPtr activeLCDPtr = reader.Read<uint32_t>();
+	uint16_t brightness = reader.Read<uint16_t>();
+	if (!reader.Ok())
+		return;
+
+	if (_instance) {
+		// Restoring into a running machine: the window stays, the LCD memory was just restored
+		if (sMemoryManager->GetVirtualAddr(reinterpret_cast<RealPtr>(_instance->_activeLCD)) != lcd) {
+			reader.Fail("LCD was created at a different address");
+			return;
+		}
+		_instance->_activeLCDPtr = activeLCDPtr;
+		_instance->brightness_level = brightness;
+		return;
+	}
+	if (!sMemoryManager->GetRealAddr(lcd) || !sMemoryManager->GetRealAddr(lcd + sizeof(LCD) - 1)) {
+		reader.Fail("LCD is not in guest memory");
+		return;
+	}
+	_instance = new LCDHandler(lcd, activeLCDPtr);
+	_instance->brightness_level = brightness;
+}
+
 LCDHandler::~LCDHandler() {
 	if (_activeLCD) {
 		_activeLCD->~LCD();
@@ -159,6 +207,11 @@ LCD::LCD() {
 		buffer[i] = 0xFF000000;
 	}
 
+	if (!LCDHandler::IsHeadless())
+		OpenWindow();
+}
+
+void LCD::OpenWindow() {
 	// --- Launch Window Thread ---
 	{
 		std::lock_guard<std::mutex> lock(g_LcdWindowMapMutex);
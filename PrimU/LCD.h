@@ -2,6 +2,9 @@
 #include <cstdint>
 #include "MemoryManager.h"
 
+class SnapshotWriter;
+class SnapshotReader;
+
 #pragma pack(push)
 #pragma pack(1)
 
@@ -48,6 +51,9 @@ struct LCD // BLIGLCD
 
     LCD();
     ~LCD();
+
+    // Shows the LCD in a host window; the constructor does this unless headless
+    void OpenWindow();
 };
 
 #pragma pack(pop)
@@ -56,17 +62,34 @@ class LCDHandler
 {
 public:
     static LCDHandler* GetInstance() { return !_instance ? _instance = new LCDHandler : _instance; }
+    // Does not create the handler; for observers on other host threads
+    static LCDHandler* PeekInstance() { return _instance; }
 
     VirtPtr GetActiveLCDPtr() const;
 
+    // Raw guest framebuffer of the active LCD, nullptr before the LCD exists
+    const void* GetFrameBuffer() const { return _activeLCD ? _activeLCD->buffer : nullptr; }
+    static constexpr size_t GetFrameBufferSize() { return sizeof(LCD::buffer); }
+
+    // Headless: LCDs keep their guest framebuffer but open no window. Must be set before first use.
+    static void SetHeadless(bool headless) { _headless = headless; }
+    static bool IsHeadless() { return _headless; }
+
     uint16_t brightness_level = 2;
 
+    // Machine snapshots: the LCD itself lives in guest memory, so only where it is and the
+    // brightness are saved. Restoring creates the handler around the restored LCD.
+    static void SaveSnapshot(SnapshotWriter& writer);
+    static void RestoreSnapshot(SnapshotReader& reader);
+
 private:
     LCDHandler();
+    LCDHandler(VirtPtr lcd, VirtPtr activeLCDPtr);
     ~LCDHandler();
     LCDHandler(LCDHandler const&) = delete;
     void operator=(LCDHandler const&) = delete;
     static LCDHandler* _instance;
+    static bool _headless;
 
     void InitActiveLCD();
     void DeleteActiveLCD();
@@ -4,15 +4,52 @@
 #include <cstdlib>
 #include <cstring>   // memcpy
 #include <algorithm>
+#include <bit>
+#include <chrono>
+#include <vector>
 
 #include "MemoryBlock.h"
 #include "executor.h"
+#include "Snapshot.h"
+#include "HostMemory.h"
 
 // 定义堆分配前后缀的 "cookie" 或 "canary"
 // 用于检测缓冲区溢出/下溢
 static const uint64_t kHeapCookie = 0xacc1c01201110210ull;
 static const size_t   kCookieSize = sizeof(kHeapCookie);
 
+// 堆块头，位于每个块起始处（客户机内存中）。16 字节，因此紧随其后的用户区保持 16 字节对齐。
+// Allocated: [header | user data | suffix cookie + padding]; the header's last 8 bytes hold the
+// prefix cookie, right in front of the user pointer. Free: the same bytes link the size class list.
+struct HeapBlock
+{
+	VirtPtr  prevPhys;  // header of the block just below, 0 for the first block
+	uint32_t sizeFlags; // whole block in bytes, a multiple of 16; kBlockFree while free
+	VirtPtr  nextFree;
+	VirtPtr  prevFree;
+};
+static_assert(sizeof(HeapBlock) == 16, "heap block headers must keep user data 16-byte aligned");
+
+static const uint32_t kBlockFree = 1;
+static const uint32_t kBlockHeaderSize = sizeof(HeapBlock);
+static const uint32_t kBlockSuffixSize = 16;
+static const uint32_t kBlockOverhead = kBlockHeaderSize + kBlockSuffixSize;
+// Header, one 16-byte granule of user data, suffix; smaller remainders stay with their block
+static const uint32_t kMinBlockSize = kBlockOverhead + 16;
+
+static inline uint32_t BlockSize(const HeapBlock* header) { return header->sizeFlags & ~kBlockFree; }
+static inline bool IsFreeBlock(const HeapBlock* header) { return (header->sizeFlags & kBlockFree) != 0; }
+
+#ifdef _DEBUG
+static HeapCheckMode g_heapCheckMode = HEAP_CHECK_FULL;
+#else
+static HeapCheckMode g_heapCheckMode = HEAP_CHECK_FREED;
+#endif
+static std::chrono::milliseconds g_heapCheckInterval(1000);
+static std::chrono::steady_clock::time_point g_nextHeapCheck;
+static constexpr std::chrono::seconds kHeapTrimInterval(5);
+static std::chrono::steady_clock::time_point g_nextHeapTrim;
+
 MemoryManager* MemoryManager::_instance = nullptr;
 
 // ... [构造函数和其它未修改的函数保持不变] ...
@@ -26,61 +63,70 @@ MemoryManager::MemoryManager()
 	uint32_t pageCount = (size + PAGE_SIZE - 1) / PAGE_SIZE;
 	size_t pageAlignedSize = pageCount * PAGE_SIZE;
 
-	RealPtr realMemory = reinterpret_cast<RealPtr>(calloc(pageCount, PAGE_SIZE));
-	if (realMemory == nullptr) {
-		fprintf(stderr, "FATAL: calloc for dynamic heap failed\n");
-		abort();
-	}
-
-	auto err = uc_mem_map_ptr(
-		sExecutor->GetUcInstance(),
-		MEM_DYNAMIC_HEAP_BASE,
-		pageAlignedSize,
-		UC_PROT_ALL,
-		realMemory
-	);
-	if (err != UC_ERR_OK) {
-		fprintf(stderr, "FATAL: uc_mem_map_ptr for dynamic heap failed, uc_err=%d\n", err);
-		free(realMemory);
+	// 按需分页：只有访问过的 64KB 块才会提交并映射到 Unicorn
+	MemoryBlock* heapBlock = nullptr;
+	ErrorCode err = DemandAlloc(MEM_DYNAMIC_HEAP_BASE, pageAlignedSize, &heapBlock);
+	if (err != ERROR_OK) {
+		fprintf(stderr, "FATAL: mapping the dynamic heap failed, error=%d\n", err);
 		abort();
 	}
-
-	// 用一个 MemoryBlock 记录这段已映射区域，但不进行子分配
-	MemoryBlock* heapBlock = new MemoryBlock(MEM_DYNAMIC_HEAP_BASE, realMemory, pageCount);
-	heapBlock->VirtualAlloc(pageAlignedSize); // 整块映射为已分配
-	_blocks.insert(heapBlock);
 	_dynamicHeapBlock = heapBlock;
 	_heapSize = pageAlignedSize;
 
-	// 初始化虚拟堆自由表：整块 32MB 为空闲
-	_heapFree.clear();
-	_heapAlloc.clear();
-	_heapFree.emplace(MEM_DYNAMIC_HEAP_BASE, _heapSize);
+	// 初始化虚拟堆：整块为一个空闲块
+	HeapBlock* first = GetHeapBlock(MEM_DYNAMIC_HEAP_BASE);
+	first->prevPhys = 0;
+	first->sizeFlags = static_cast<uint32_t>(_heapSize) | kBlockFree;
+	InsertFreeBlock(MEM_DYNAMIC_HEAP_BASE);
 }
 
 MemoryManager::~MemoryManager()
 {
 	// 释放所有映射（包括动态堆）
 	for (auto block : _blocks) {
-		uc_mem_unmap(sExecutor->GetUcInstance(), block->GetVAddr(), block->GetSize());
-		free(block->GetRAddr());
+		UnmapBlock(block);
+		HostMemory::Free(block->GetRAddr());
 		delete block;
 	}
 	_blocks.clear();
+	_demandBlocks.clear();
+	_hostBlocks.clear();
+	_lastHostBlock = nullptr;
 	_dynamicHeapBlock = nullptr;
 }
 
 // ... [StaticAlloc, StaticFree, OverlapsAnyMappedBlock 等函数保持不变] ...
 bool MemoryManager::OverlapsAnyMappedBlock(VirtPtr addr, size_t size) const
 {
-	for (auto block : _blocks) {
-		VirtPtr b = block->GetVAddr();
-		size_t   s = block->GetSize();
-		if (RangeOverlaps(addr, size, b, s)) return true;
+	uint64_t end = static_cast<uint64_t>(addr) + size;
+	for (uint64_t page = addr / PAGE_SIZE; page * PAGE_SIZE < end && page < (1ull << 32) / PAGE_SIZE; page++) {
+		if (LookupBlock(static_cast<VirtPtr>(page * PAGE_SIZE))) return true;
 	}
 	return false;
 }
 
+// Points every page of the block at `entry`: the block itself when mapping, nullptr when unmapping
+void MemoryManager::IndexBlock(MemoryBlock* block, MemoryBlock* entry)
+{
+	uint32_t first = block->GetVAddr() / PAGE_SIZE;
+	for (uint32_t page = first; page < first + block->GetPageCount(); page++) {
+		std::unique_ptr<MemoryBlock*[]>& table = _pageTable[page >> kPageTableBits];
+		if (!table) {
+			if (!entry) continue;
+			table.reset(new MemoryBlock*[kPageTableSize]());
+		}
+		table[page & (kPageTableSize - 1)] = entry;
+	}
+
+	if (entry) {
+		_hostBlocks[block->GetRAddr()] = block;
+	}
+	else {
+		_hostBlocks.erase(block->GetRAddr());
+		if (_lastHostBlock == block) _lastHostBlock = nullptr;
+	}
+}
+
 ErrorCode MemoryManager::StaticAlloc(VirtPtr addr, size_t size, MemoryBlock** memoryBlock)
 {
 	if (size == 0) {
@@ -97,14 +143,39 @@ ErrorCode MemoryManager::StaticAlloc(VirtPtr addr, size_t size, MemoryBlock** me
 	uint32_t pageCount = (size + PAGE_SIZE - 1) / PAGE_SIZE;
 	size_t   pageAlignedSize = pageCount * PAGE_SIZE;
 
-	RealPtr realMemory = reinterpret_cast<RealPtr>(calloc(pageCount, PAGE_SIZE));
+	RealPtr realMemory = HostMemory::Allocate(pageAlignedSize);
+	if (!realMemory) {
+		return ERROR_MEM_ALLOC_FAIL;
+	}
+
+	return MapBlock(addr, realMemory, pageCount, memoryBlock);
+}
+
+ErrorCode MemoryManager::MapFile(VirtPtr addr, const std::string& path, uint64_t offset, size_t size, MemoryBlock** memoryBlock)
+{
+	if (size == 0) {
+		if (memoryBlock) *memoryBlock = nullptr;
+		return ERROR_OK;
+	}
+
+	if (OverlapsAnyMappedBlock(addr, size)) {
+		return ERROR_MEM_ALREADY_ALLOCATED;
+	}
+
+	RealPtr realMemory = HostMemory::MapFile(path, offset, size);
 	if (!realMemory) {
 		return ERROR_MEM_ALLOC_FAIL;
 	}
 
+	return MapBlock(addr, realMemory, static_cast<uint32_t>((size + PAGE_SIZE - 1) / PAGE_SIZE), memoryBlock);
+}
+
+ErrorCode MemoryManager::MapBlock(VirtPtr addr, RealPtr realMemory, uint32_t pageCount, MemoryBlock** memoryBlock)
+{
+	size_t pageAlignedSize = static_cast<size_t>(pageCount) * PAGE_SIZE;
 	auto err = uc_mem_map_ptr(sExecutor->GetUcInstance(), addr, pageAlignedSize, UC_PROT_ALL, realMemory);
 	if (err != UC_ERR_OK) {
-		free(realMemory);
+		HostMemory::Free(realMemory);
 		return ERROR_UC_MAP;
 	}
 
@@ -112,30 +183,124 @@ ErrorCode MemoryManager::StaticAlloc(VirtPtr addr, size_t size, MemoryBlock** me
 	newBlock->VirtualAlloc(pageAlignedSize); // 整块映射为已分配
 
 	_blocks.insert(newBlock);
+	IndexBlock(newBlock, newBlock);
 
 	if (memoryBlock) *memoryBlock = newBlock;
 	return ERROR_OK;
 }
 
+ErrorCode MemoryManager::DemandAlloc(VirtPtr addr, size_t size, MemoryBlock** memoryBlock)
+{
+	// 引擎中按整块映射，块必须由完整的 chunk 组成
+	if (addr % HOST_COMMIT_CHUNK || size % HOST_COMMIT_CHUNK) {
+		return StaticAlloc(addr, size, memoryBlock);
+	}
+	if (size == 0) {
+		if (memoryBlock) *memoryBlock = nullptr;
+		return ERROR_OK;
+	}
+
+	if (OverlapsAnyMappedBlock(addr, size)) {
+		return ERROR_MEM_ALREADY_ALLOCATED;
+	}
+
+	RealPtr realMemory = HostMemory::Reserve(size);
+	if (!realMemory) {
+		return ERROR_MEM_ALLOC_FAIL;
+	}
+
+	// Indexed like any other block, so host-side lookups work before the guest touches it
+	MemoryBlock* newBlock = new MemoryBlock(addr, realMemory, static_cast<uint32_t>(size / PAGE_SIZE));
+	newBlock->VirtualAlloc(size);
+	_blocks.insert(newBlock);
+	IndexBlock(newBlock, newBlock);
+	_demandBlocks[newBlock].assign(size / HOST_COMMIT_CHUNK, 0);
+
+	if (memoryBlock) *memoryBlock = newBlock;
+	return ERROR_OK;
+}
+
+bool MemoryManager::MapDemandChunk(VirtPtr addr)
+{
+	MemoryBlock* block = LookupBlock(addr);
+	if (!block) return false;
+	auto it = _demandBlocks.find(block);
+	if (it == _demandBlocks.end()) return false;
+
+	// An access to a chunk that is already mapped faulted for some other reason
+	size_t chunk = (addr - block->GetVAddr()) / HOST_COMMIT_CHUNK;
+	if (it->second[chunk]) return false;
+
+	RealPtr realChunk = block->GetRAddr() + chunk * HOST_COMMIT_CHUNK;
+	if (!HostMemory::Commit(realChunk, HOST_COMMIT_CHUNK)) return false;
+	VirtPtr vChunk = block->GetVAddr() + static_cast<VirtPtr>(chunk * HOST_COMMIT_CHUNK);
+	if (uc_mem_map_ptr(sExecutor->GetUcInstance(), vChunk, HOST_COMMIT_CHUNK, UC_PROT_ALL, realChunk) != UC_ERR_OK) return false;
+	it->second[chunk] = 1;
+	return true;
+}
+
+// Unmaps the block from the engine; demand-paged blocks chunk by chunk, as uc_mem_unmap needs a
+// fully mapped range
+bool MemoryManager::UnmapBlock(MemoryBlock* block)
+{
+	auto it = _demandBlocks.find(block);
+	if (it == _demandBlocks.end()) {
+		return uc_mem_unmap(sExecutor->GetUcInstance(), block->GetVAddr(), block->GetSize()) == UC_ERR_OK;
+	}
+
+	bool ok = true;
+	for (size_t chunk = 0; chunk < it->second.size(); chunk++) {
+		if (!it->second[chunk]) continue;
+		VirtPtr vChunk = block->GetVAddr() + static_cast<VirtPtr>(chunk * HOST_COMMIT_CHUNK);
+		if (uc_mem_unmap(sExecutor->GetUcInstance(), vChunk, HOST_COMMIT_CHUNK) == UC_ERR_OK) it->second[chunk] = 0;
+		else ok = false;
+	}
+	return ok;
+}
+
+MemoryBlock* MemoryManager::RemapBlock(MemoryBlock* block, VirtPtr addr, size_t size)
+{
+	RealPtr realMemory = block->GetRAddr();
+	std::vector<uint8_t> mapped;
+	if (addr == block->GetVAddr()) mapped = std::move(_demandBlocks[block]);
+	else UnmapBlock(block);
+	mapped.resize(size / HOST_COMMIT_CHUNK, 0);
+	// The tracked size no longer matches, so the block no longer counts as part of a baseline
+	HostMemory::Untrack(realMemory);
+
+	IndexBlock(block, nullptr);
+	_blocks.erase(block);
+	_demandBlocks.erase(block);
+	delete block;
+
+	MemoryBlock* newBlock = new MemoryBlock(addr, realMemory, static_cast<uint32_t>(size / PAGE_SIZE));
+	newBlock->VirtualAlloc(size);
+	_blocks.insert(newBlock);
+	IndexBlock(newBlock, newBlock);
+	_demandBlocks[newBlock] = std::move(mapped);
+	return newBlock;
+}
+
 ErrorCode MemoryManager::StaticFree(VirtPtr addr)
 {
-	for (auto it = _blocks.begin(); it != _blocks.end(); ++it) {
-		auto block = *it;
-		if (block->GetVAddr() == addr) {
-			// 禁止通过 StaticFree 释放主虚拟堆
-			if (block == _dynamicHeapBlock) {
-				return ERROR_MEM_STATIC_NOT_FREEABLE;
-			}
-			if (uc_mem_unmap(sExecutor->GetUcInstance(), addr, block->GetSize()) != UC_ERR_OK) {
-				return ERROR_UC_UNMAP;
-			}
-			free(block->GetRAddr());
-			delete block;
-			_blocks.erase(it);
-			return ERROR_OK;
-		}
+	MemoryBlock* block = FindBlock(addr);
+	if (!block) {
+		return ERROR_MEM_ADDR_NOT_ALLOCATED;
 	}
-	return ERROR_MEM_ADDR_NOT_ALLOCATED;
+	// 禁止通过 StaticFree 释放主虚拟堆
+	if (block == _dynamicHeapBlock) {
+		return ERROR_MEM_STATIC_NOT_FREEABLE;
+	}
+	if (!UnmapBlock(block)) {
+		return ERROR_UC_UNMAP;
+	}
+	IndexBlock(block, nullptr);
+	_blocks.erase(block);
+	_demandBlocks.erase(block);
+	_largeObjects.erase(addr);
+	HostMemory::Free(block->GetRAddr());
+	delete block;
+	return ERROR_OK;
 }
 
 // ====== 虚拟堆：子分配实现 (增加了Cookie) ======
@@ -162,138 +327,280 @@ void MemoryManager::CheckCookie(VirtPtr addr) {
 	}
 }
 
-ErrorCode MemoryManager::HeapAlloc(VirtPtr* out, size_t size)
+void MemoryManager::SetHeapCheck(HeapCheckMode mode)
 {
-	if (!_dynamicHeapBlock) return ERROR_MEM_ALLOC_FAIL;
+	g_heapCheckMode = mode;
+}
 
-	if (size == 0) {
-		*out = 0;
-		return ERROR_OK;
-	}
+void MemoryManager::SetHeapCheckInterval(uint32_t intervalMs)
+{
+	g_heapCheckInterval = std::chrono::milliseconds(intervalMs);
+}
 
-	size_t alignedUserSize = AlignUp(size, kHeapAlign);
-	// 总分配大小 = 前缀cookie + 对齐后的用户区 + 后缀cookie
-	size_t totalAllocSize = alignedUserSize + 2 * kCookieSize;
+void MemoryManager::CheckHeap()
+{
+	// 按物理顺序遍历所有块
+	VirtPtr end = MEM_DYNAMIC_HEAP_BASE + static_cast<VirtPtr>(_heapSize);
+	VirtPtr prev = 0;
+	for (VirtPtr block = MEM_DYNAMIC_HEAP_BASE; block < end;) {
+		HeapBlock* header = GetHeapBlock(block);
+		uint32_t size = BlockSize(header);
+		if (header->prevPhys != prev || size < kMinBlockSize || size > end - block) {
+			fprintf(stderr, "FATAL: Heap corruption detected in the block header at 0x%08x.\n", block);
+			abort();
+		}
+		if (!IsFreeBlock(header)) {
+			CheckCookie(block + kBlockHeaderSize - static_cast<VirtPtr>(kCookieSize)); // 检查前缀
+			CheckCookie(block + size - kBlockSuffixSize);                             // 检查后缀
+		}
+		prev = block;
+		block += size;
+	}
 
-	// First-fit
-	for (auto it = _heapFree.begin(); it != _heapFree.end(); ++it) {
-		VirtPtr freeStart = it->first;
-		size_t  freeSize = it->second;
+	for (const auto& object : _largeObjects) {
+		CheckCookie(object.first + static_cast<VirtPtr>(AlignUp(object.second.size, kCookieSize)));
+	}
+}
 
-		// 简单处理：要求整个分配块对齐。更优化的分配器可以只对齐用户区。
-		VirtPtr alignedStart = static_cast<VirtPtr>(AlignUp(freeStart, kHeapAlign));
-		size_t  prefix = static_cast<size_t>(alignedStart - freeStart);
+void MemoryManager::PeriodicHeapCheck()
+{
+	if (g_heapCheckMode != HEAP_CHECK_SAMPLED) return;
 
-		if (freeSize < prefix) continue;
-		size_t usable = freeSize - prefix;
-		if (usable < totalAllocSize) continue;
+	auto now = std::chrono::steady_clock::now();
+	if (now < g_nextHeapCheck) return;
+	CheckHeap();
+	g_nextHeapCheck = now + g_heapCheckInterval;
+}
 
-		// 从该空闲块中切出
-		VirtPtr blockStart = alignedStart; // 包含cookie的整个块的起始地址
-		VirtPtr blockEnd = blockStart + static_cast<VirtPtr>(totalAllocSize);
-		VirtPtr freeEnd = freeStart + static_cast<VirtPtr>(freeSize);
+void MemoryManager::PeriodicHeapTrim()
+{
+	auto now = std::chrono::steady_clock::now();
+	if (now < g_nextHeapTrim) return;
+	g_nextHeapTrim = now + kHeapTrimInterval;
+
+	// Smaller size classes cannot hold a whole chunk
+	uint32_t minFl, minSl;
+	MapHeapSize(HOST_COMMIT_CHUNK, &minFl, &minSl);
+	for (uint32_t fl = minFl; fl < kHeapFlCount; fl++) {
+		if (!(_heapFlBitmap & (1u << fl))) continue;
+		for (uint32_t sl = 0; sl < kHeapSlCount; sl++) {
+			for (VirtPtr block = _heapFreeLists[fl][sl]; block; block = GetHeapBlock(block)->nextFree) {
+				TrimFreeBlock(block);
+			}
+		}
+	}
+}
 
-		// 移除旧的空闲块
-		_heapFree.erase(it);
+// ====== TLSF 内部操作 ======
 
-		// 归还前缀和尾部空闲
-		if (prefix > 0) {
-			_heapFree.emplace(freeStart, prefix);
-		}
-		if (blockEnd < freeEnd) {
-			_heapFree.emplace(blockEnd, static_cast<size_t>(freeEnd - blockEnd));
-		}
+HeapBlock* MemoryManager::GetHeapBlock(VirtPtr block) const
+{
+	// The heap is one host allocation, so no page table lookup is needed
+	return reinterpret_cast<HeapBlock*>(_dynamicHeapBlock->GetRAddr() + (block - MEM_DYNAMIC_HEAP_BASE));
+}
 
-		// 写入 cookies
-		VirtPtr userPtr = blockStart + kCookieSize;
-		WriteCookie(blockStart); // 前缀 cookie
-		WriteCookie(userPtr + static_cast<VirtPtr>(alignedUserSize)); // 后缀 cookie
+// True if `block` is the header of a live allocation: its neighbours must point back at it, which
+// rejects pointers that were never returned by HeapAlloc as well as double frees
+bool MemoryManager::IsAllocatedBlock(VirtPtr block) const
+{
+	VirtPtr base = MEM_DYNAMIC_HEAP_BASE;
+	VirtPtr end = base + static_cast<VirtPtr>(_heapSize);
+	if (block < base || block > end - kMinBlockSize || (block - base) % kHeapAlign != 0) return false;
+
+	const HeapBlock* header = GetHeapBlock(block);
+	uint32_t size = BlockSize(header);
+	if (IsFreeBlock(header) || size < kMinBlockSize || size > end - block) return false;
+	if (block + size < end && GetHeapBlock(block + size)->prevPhys != block) return false;
+
+	VirtPtr prev = header->prevPhys;
+	if (prev == 0) return block == base;
+	if (prev < base || prev >= block || (prev - base) % kHeapAlign != 0) return false;
+	return prev + BlockSize(GetHeapBlock(prev)) == block;
+}
 
-		// 记录已分配（key是用户指针，value是用户大小）
-		_heapAlloc.emplace(userPtr, alignedUserSize);
+void MemoryManager::MapHeapSize(uint32_t size, uint32_t* fl, uint32_t* sl)
+{
+	if (size < (1u << kHeapFlShift)) {
+		// 小块：按 16 字节线性分级
+		*fl = 0;
+		*sl = size / (1u << (kHeapFlShift - kHeapSlLog2));
+	}
+	else {
+		uint32_t log2 = static_cast<uint32_t>(std::bit_width(size)) - 1;
+		*sl = (size >> (log2 - kHeapSlLog2)) ^ kHeapSlCount;
+		*fl = log2 - (kHeapFlShift - 1);
+	}
+}
 
-		*out = userPtr;
-		return ERROR_OK;
+// Smallest free block of at least `size` bytes, or 0. Sizes are rounded up to the next class
+// first, so any block of the class found fits and the lists never need to be searched.
+VirtPtr MemoryManager::FindFreeBlock(uint32_t size)
+{
+	if (size >= (1u << kHeapFlShift)) {
+		uint32_t round = (1u << (std::bit_width(size) - 1 - kHeapSlLog2)) - 1;
+		if (size > UINT32_MAX - round) return 0;
+		size += round;
 	}
-	__debugbreak();
-	return ERROR_MEM_ALLOC_FAIL;
+	uint32_t fl, sl;
+	MapHeapSize(size, &fl, &sl);
+	if (fl >= kHeapFlCount) return 0;
+
+	uint32_t slMap = _heapSlBitmap[fl] & (~0u << sl);
+	if (!slMap) {
+		uint32_t flMap = fl + 1 < kHeapFlCount ? _heapFlBitmap & (~0u << (fl + 1)) : 0;
+		if (!flMap) return 0;
+		fl = static_cast<uint32_t>(std::countr_zero(flMap));
+		slMap = _heapSlBitmap[fl];
+	}
+	sl = static_cast<uint32_t>(std::countr_zero(slMap));
+	return _heapFreeLists[fl][sl];
 }
 
-ErrorCode MemoryManager::HeapFree(VirtPtr addr)
+void MemoryManager::InsertFreeBlock(VirtPtr block)
 {
-	for (auto& item : _heapAlloc) {
-		size_t userSize = item.second;
-		VirtPtr userPtr = item.first;
+	HeapBlock* header = GetHeapBlock(block);
+	uint32_t fl, sl;
+	MapHeapSize(BlockSize(header), &fl, &sl);
+
+	VirtPtr head = _heapFreeLists[fl][sl];
+	header->nextFree = head;
+	header->prevFree = 0;
+	if (head) GetHeapBlock(head)->prevFree = block;
+	_heapFreeLists[fl][sl] = block;
+	_heapFlBitmap |= 1u << fl;
+	_heapSlBitmap[fl] |= 1u << sl;
+}
+
+void MemoryManager::RemoveFreeBlock(VirtPtr block)
+{
+	HeapBlock* header = GetHeapBlock(block);
+	uint32_t fl, sl;
+	MapHeapSize(BlockSize(header), &fl, &sl);
 
-		// 计算实际分配块的边界
-		VirtPtr blockStart = userPtr - kCookieSize;
-		VirtPtr suffixCookieAddr = userPtr + static_cast<VirtPtr>(userSize);
-		size_t totalSize = userSize + 2 * kCookieSize;
-		CheckCookie(blockStart);       // 检查前缀
-		CheckCookie(suffixCookieAddr); // 检查后缀
+	if (header->nextFree) GetHeapBlock(header->nextFree)->prevFree = header->prevFree;
+	if (header->prevFree) {
+		GetHeapBlock(header->prevFree)->nextFree = header->nextFree;
+	}
+	else {
+		_heapFreeLists[fl][sl] = header->nextFree;
+		if (!header->nextFree) {
+			_heapSlBitmap[fl] &= ~(1u << sl);
+			if (!_heapSlBitmap[fl]) _heapFlBitmap &= ~(1u << fl);
+		}
 	}
-	{
-		auto it = _heapAlloc.find(addr);
-		if (it == _heapAlloc.end()) return ERROR_MEM_ADDR_NOT_ALLOCATED;
+}
 
-		size_t userSize = it->second;
-		VirtPtr userPtr = it->first;
+// Sets a block's size and keeps the back link of the block after it in step
+void MemoryManager::SetBlockSize(VirtPtr block, uint32_t size, bool free)
+{
+	GetHeapBlock(block)->sizeFlags = size | (free ? kBlockFree : 0);
+	VirtPtr next = block + size;
+	if (next < MEM_DYNAMIC_HEAP_BASE + _heapSize) GetHeapBlock(next)->prevPhys = block;
+}
 
-		// 计算实际分配块的边界
-		VirtPtr blockStart = userPtr - kCookieSize;
-		VirtPtr suffixCookieAddr = userPtr + static_cast<VirtPtr>(userSize);
-		size_t totalSize = userSize + 2 * kCookieSize;
+// Returns [block, block + size) to the free lists, merged with free neighbours; block's header
+// need only have prevPhys set
+// Returns the free block that `block` ended up in
+VirtPtr MemoryManager::ReleaseBlock(VirtPtr block, uint32_t size)
+{
+	VirtPtr next = block + size;
+	if (next < MEM_DYNAMIC_HEAP_BASE + _heapSize && IsFreeBlock(GetHeapBlock(next))) {
+		RemoveFreeBlock(next);
+		size += BlockSize(GetHeapBlock(next));
+	}
+	VirtPtr prev = GetHeapBlock(block)->prevPhys;
+	if (prev && IsFreeBlock(GetHeapBlock(prev))) {
+		RemoveFreeBlock(prev);
+		size += BlockSize(GetHeapBlock(prev));
+		block = prev;
+	}
+	SetBlockSize(block, size, true);
+	InsertFreeBlock(block);
+	return block;
+}
 
-		// 从已分配表中移除
-		_heapAlloc.erase(it);
+// Decommits the whole chunks inside a free block, past its header; they come back zeroed when
+// the block is next used
+void MemoryManager::TrimFreeBlock(VirtPtr block)
+{
+	VirtPtr first = static_cast<VirtPtr>(AlignUp(block + kBlockHeaderSize, HOST_COMMIT_CHUNK));
+	VirtPtr end = (block + BlockSize(GetHeapBlock(block))) & ~static_cast<VirtPtr>(HOST_COMMIT_CHUNK - 1);
+	if (first >= end) return;
+	_heapTrimmed += HostMemory::Decommit(GetRealAddr(first), end - first);
+}
 
-		// 放回空闲并合并邻接（归还的是包含 cookie 的整个块）
-		CoalesceAround(blockStart, totalSize);
-		return ERROR_OK;
-	}
+// Trims an allocated block to `size` bytes if the rest is large enough to be a block of its own
+void MemoryManager::SplitBlock(VirtPtr block, uint32_t size)
+{
+	uint32_t blockSize = BlockSize(GetHeapBlock(block));
+	if (blockSize - size < kMinBlockSize) return;
+
+	SetBlockSize(block, size, false);
+	ReleaseBlock(block + size, blockSize - size);
 }
 
+// ====== 虚拟堆：分配与释放 ======
 
-// ... [CoalesceAround 函数保持不变] ...
-void MemoryManager::CoalesceAround(VirtPtr start, size_t size)
+ErrorCode MemoryManager::HeapAlloc(VirtPtr* out, size_t size)
 {
-	// 合并邻接空闲块：[prevEnd==start] 或 [end==nextStart]
-	VirtPtr end = start + static_cast<VirtPtr>(size);
+	if (!_dynamicHeapBlock) return ERROR_MEM_ALLOC_FAIL;
 
-	// 找到第一个 key > start 的迭代器
-	auto nextIt = _heapFree.upper_bound(start);
+	if (size == 0) {
+		*out = 0;
+		return ERROR_OK;
+	}
 
-	// 尝试与前一个合并
-	if (nextIt != _heapFree.begin()) {
-		auto prevIt = std::prev(nextIt);
-		VirtPtr prevStart = prevIt->first;
-		size_t  prevSize = prevIt->second;
-		VirtPtr prevEnd = prevStart + static_cast<VirtPtr>(prevSize);
-		if (prevEnd == start) {
-			// merge 到前块
-			start = prevStart;
-			size += prevSize;
-			_heapFree.erase(prevIt);
-		}
+	// 块大小 = 块头（含前缀cookie） + 对齐后的用户区 + 后缀cookie
+	VirtPtr block = size <= _heapSize ? FindFreeBlock(static_cast<uint32_t>(AlignUp(size, kHeapAlign)) + kBlockOverhead) : 0;
+	if (!block) {
+		HeapStats stats = GetHeapStats();
+		fprintf(stderr, "Heap: cannot allocate %zu bytes; %zu bytes in use, %zu free in %u blocks, largest allocation possible %zu\n",
+			size, stats.inUse, stats.freeBytes, stats.freeBlocks, stats.largestFree);
+#ifdef _DEBUG
+		__debugbreak();
+#endif
+		return ERROR_MEM_ALLOC_FAIL;
 	}
 
-	// 尝试与后一个合并（必须用新的 start/size 计算 end）
-	end = start + static_cast<VirtPtr>(size);
-	nextIt = _heapFree.lower_bound(start);
-	if (nextIt != _heapFree.end()) {
-		VirtPtr nextStart = nextIt->first;
-		size_t  nextSize = nextIt->second;
-		if (end == nextStart) {
-			// merge 到后块
-			size += nextSize;
-			_heapFree.erase(nextIt);
-		}
+	RemoveFreeBlock(block);
+	HeapBlock* header = GetHeapBlock(block);
+	SetBlockSize(block, BlockSize(header), false);
+	SplitBlock(block, static_cast<uint32_t>(AlignUp(size, kHeapAlign)) + kBlockOverhead);
+
+	// 写入 cookies
+	uint32_t blockSize = BlockSize(header);
+	VirtPtr userPtr = block + kBlockHeaderSize;
+	WriteCookie(userPtr - static_cast<VirtPtr>(kCookieSize)); // 前缀 cookie
+	WriteCookie(block + blockSize - kBlockSuffixSize);       // 后缀 cookie
+
+	AddHeapInUse(blockSize - kBlockOverhead);
+	CountAlloc(size);
+	*out = userPtr;
+	return ERROR_OK;
+}
+
+ErrorCode MemoryManager::HeapFree(VirtPtr addr)
+{
+	if (g_heapCheckMode == HEAP_CHECK_FULL) CheckHeap();
+
+	VirtPtr block = addr - kBlockHeaderSize;
+	if (!IsAllocatedBlock(block)) return ERROR_MEM_ADDR_NOT_ALLOCATED;
+
+	uint32_t blockSize = BlockSize(GetHeapBlock(block));
+	if (g_heapCheckMode != HEAP_CHECK_OFF) {
+		CheckCookie(addr - static_cast<VirtPtr>(kCookieSize)); // 检查前缀
+		CheckCookie(block + blockSize - kBlockSuffixSize);     // 检查后缀
 	}
 
-	// 放回合并后的块
-	_heapFree.emplace(start, size);
+	_heapInUse -= blockSize - kBlockOverhead;
+	_freeCount++;
+	// 放回空闲并合并邻接
+	VirtPtr freed = ReleaseBlock(block, blockSize);
+	if (BlockSize(GetHeapBlock(freed)) >= kHeapTrimThreshold) TrimFreeBlock(freed);
+	return ERROR_OK;
 }
 
+
 // ... [DyanmicAlloc, DynamicFree 保持不变，因为它们调用 HeapAlloc/HeapFree] ...
 ErrorCode MemoryManager::DyanmicAlloc(VirtPtr* addr, size_t size)
 {
@@ -301,13 +608,23 @@ ErrorCode MemoryManager::DyanmicAlloc(VirtPtr* addr, size_t size)
 		*addr = 0;
 		return ERROR_OK;
 	}
-	return HeapAlloc(addr, size);
+	// 大块优先走独立区间；区间用尽时退回虚拟堆
+	if (size >= kLargeAllocThreshold && LargeAlloc(addr, size) == ERROR_OK) {
+		return ERROR_OK;
+	}
+	ErrorCode err = HeapAlloc(addr, size);
+	if (err != ERROR_OK) _allocFailures++;
+	return err;
 }
 
 ErrorCode MemoryManager::DynamicFree(VirtPtr addr)
 {
 	if (addr == 0) return ERROR_OK;
 
+	if (_largeObjects.count(addr)) {
+		return LargeFree(addr);
+	}
+
 	// 虚拟堆内：只改元数据，不做 uc_mem_unmap
 	if (HeapContains(addr)) {
 		return HeapFree(addr);
@@ -329,50 +646,39 @@ ErrorCode MemoryManager::DynamicFree(VirtPtr addr)
 
 // ====== Realloc 逻辑 (增加了Cookie) ======
 
-bool MemoryManager::TryHeapReallocInPlace(VirtPtr addr, size_t oldSize, size_t newSize)
+// newSize is the aligned user size; addr must be a live allocation
+bool MemoryManager::TryHeapReallocInPlace(VirtPtr addr, size_t newSize)
 {
+	VirtPtr block = addr - kBlockHeaderSize;
+	HeapBlock* header = GetHeapBlock(block);
+	uint32_t oldSize = BlockSize(header);
+
 	// realloc前先检查cookie的完整性
-	VirtPtr blockStart = addr - kCookieSize;
-	CheckCookie(blockStart);
-	CheckCookie(addr + static_cast<VirtPtr>(oldSize));
-
-	if (newSize <= oldSize) {
-		// 就地缩小：把尾部释放回自由表
-		size_t shrink = oldSize - newSize;
-		if (shrink > 0) {
-			VirtPtr tail = addr + static_cast<VirtPtr>(newSize);
-			// 在新的结尾处写入新的后缀cookie
-			WriteCookie(tail);
-			// 将 [new_suffix_cookie_end, old_suffix_cookie_end) 之间的空间释放
-			CoalesceAround(tail + kCookieSize, shrink);
-		}
-		_heapAlloc[addr] = newSize;
-		return true;
-	}
-
-	// 需要扩展：检测后邻是否空闲且足够
-	size_t  need = newSize - oldSize;
-	// 寻找从旧块后缀cookie之后开始的空闲块
-	VirtPtr tail = addr + static_cast<VirtPtr>(oldSize) + kCookieSize;
-
-	auto nextIt = _heapFree.find(tail);
-	if (nextIt != _heapFree.end()) {
-		size_t nextSize = nextIt->second;
-		if (nextSize >= need) {
-			// 从后邻空闲块吃掉 need
-			_heapFree.erase(nextIt);
-			size_t remain = nextSize - need;
-			if (remain > 0) {
-				_heapFree.emplace(tail + static_cast<VirtPtr>(need), remain);
-			}
-			// 更新分配大小并写入新的后缀cookie
-			_heapAlloc[addr] = newSize;
-			WriteCookie(addr + static_cast<VirtPtr>(newSize));
-			return true;
-		}
+	if (g_heapCheckMode != HEAP_CHECK_OFF) {
+		CheckCookie(addr - static_cast<VirtPtr>(kCookieSize));
+		CheckCookie(block + oldSize - kBlockSuffixSize);
 	}
 
-	return false;
+	if (newSize > _heapSize) return false;
+	uint32_t need = static_cast<uint32_t>(newSize) + kBlockOverhead;
+	if (need > oldSize) {
+		// 需要扩展：后邻空闲且足够时将其并入
+		VirtPtr next = block + oldSize;
+		if (next >= MEM_DYNAMIC_HEAP_BASE + _heapSize) return false;
+		HeapBlock* nextHeader = GetHeapBlock(next);
+		if (!IsFreeBlock(nextHeader) || oldSize + BlockSize(nextHeader) < need) return false;
+
+		RemoveFreeBlock(next);
+		SetBlockSize(block, oldSize + BlockSize(nextHeader), false);
+	}
+	// 缩小或扩展后多出的尾部归还自由表
+	SplitBlock(block, need);
+
+	uint32_t blockSize = BlockSize(header);
+	WriteCookie(block + blockSize - kBlockSuffixSize); // 新的后缀cookie
+	_heapInUse -= oldSize - kBlockOverhead;
+	AddHeapInUse(blockSize - kBlockOverhead);
+	return true;
 }
 
 ErrorCode MemoryManager::DynamicRealloc(VirtPtr* addr, size_t newsize)
@@ -386,22 +692,22 @@ ErrorCode MemoryManager::DynamicRealloc(VirtPtr* addr, size_t newsize)
 		*addr = 0;
 		return DynamicFree(oldAddr);
 	}
+	_reallocCount++;
 
 	if (HeapContains(oldAddr)) {
-		auto it = _heapAlloc.find(oldAddr);
-		if (it == _heapAlloc.end()) return ERROR_MEM_ADDR_NOT_ALLOCATED;
-		size_t oldSize = it->second;
+		if (!IsAllocatedBlock(oldAddr - kBlockHeaderSize)) return ERROR_MEM_ADDR_NOT_ALLOCATED;
+		size_t oldSize = GetAllocSize(oldAddr);
 
 		size_t alignedNewSize = AlignUp(newsize, kHeapAlign);
 
-		if (TryHeapReallocInPlace(oldAddr, oldSize, alignedNewSize)) {
+		if (TryHeapReallocInPlace(oldAddr, alignedNewSize)) {
 			// *addr 保持不变
 			return ERROR_OK;
 		}
 
-		// 分配新块 + 拷贝 + 释放旧块
+		// 分配新块 + 拷贝 + 释放旧块；长到大块阈值以上的从此走大块路径
 		VirtPtr newAddr = 0;
-		ErrorCode err = HeapAlloc(&newAddr, alignedNewSize);
+		ErrorCode err = DyanmicAlloc(&newAddr, alignedNewSize);
 		if (err != ERROR_OK) return err;
 
 		// 拷贝旧数据 (只拷贝用户区)
@@ -413,7 +719,7 @@ ErrorCode MemoryManager::DynamicRealloc(VirtPtr* addr, size_t newsize)
 		}
 		else {
 			// 理论上不应发生，因为地址都是刚分配/验证过的
-			HeapFree(newAddr); // 回滚分配
+			DynamicFree(newAddr); // 回滚分配
 			return ERROR_MEM_ADDR_NOT_ALLOCATED;
 		}
 
@@ -424,49 +730,491 @@ ErrorCode MemoryManager::DynamicRealloc(VirtPtr* addr, size_t newsize)
 		return ERROR_OK;
 	}
 
+	if (_largeObjects.count(oldAddr)) {
+		return LargeRealloc(addr, newsize);
+	}
+
 	return ERROR_MEM_ADDR_NOT_ALLOCATED;
 }
 
+// ====== 大块分配 ======
+
+// Copies a large allocation's contents. Chunks it never touched read as zero; they are skipped,
+// and only cleared at the destination where it has memory already.
+static void CopyChunks(RealPtr dst, RealPtr src, size_t size)
+{
+	for (size_t offset = 0; offset < size; offset += HOST_COMMIT_CHUNK) {
+		size_t count = std::min<size_t>(HOST_COMMIT_CHUNK, size - offset);
+		if (HostMemory::IsCommitted(src + offset)) memcpy(dst + offset, src + offset, count);
+		else if (HostMemory::IsCommitted(dst + offset)) memset(dst + offset, 0, count);
+	}
+}
+
+// User data, suffix cookie and half the size again as room to grow
+size_t MemoryManager::LargeSpanSize(size_t size)
+{
+	return AlignUp(AlignUp(size, kCookieSize) + kCookieSize + size / 2, HOST_COMMIT_CHUNK);
+}
+
+// Lowest free guest range of `span` bytes in the large allocation area, or 0
+VirtPtr MemoryManager::FindLargeSpan(size_t span)
+{
+	uint64_t end = static_cast<uint64_t>(MEM_LARGE_HEAP_BASE) + MEM_LARGE_HEAP_SIZE;
+	uint64_t candidate = MEM_LARGE_HEAP_BASE;
+	auto it = _largeObjects.begin();
+	for (;;) {
+		uint64_t limit = it == _largeObjects.end() ? end : it->first;
+		if (candidate + span <= limit && !OverlapsAnyMappedBlock(static_cast<VirtPtr>(candidate), span)) {
+			return static_cast<VirtPtr>(candidate);
+		}
+		if (it == _largeObjects.end()) return 0;
+		candidate = std::max<uint64_t>(candidate, it->first + it->second.block->GetSize());
+		++it;
+	}
+}
+
+ErrorCode MemoryManager::LargeAlloc(VirtPtr* out, size_t size)
+{
+	if (size > MEM_LARGE_HEAP_SIZE) return ERROR_MEM_ALLOC_FAIL;
+	size_t span = LargeSpanSize(size);
+	VirtPtr addr = FindLargeSpan(span);
+	if (!addr) return ERROR_MEM_ALLOC_FAIL;
+
+	MemoryBlock* block = nullptr;
+	ErrorCode err = DemandAlloc(addr, span, &block);
+	if (err != ERROR_OK) return err;
+
+	_largeObjects[addr] = LargeObject{ block, static_cast<uint32_t>(size) };
+	WriteCookie(addr + static_cast<VirtPtr>(AlignUp(size, kCookieSize)));
+	AddHeapInUse(size);
+	CountAlloc(size);
+	*out = addr;
+	return ERROR_OK;
+}
+
+ErrorCode MemoryManager::LargeFree(VirtPtr addr)
+{
+	if (g_heapCheckMode == HEAP_CHECK_FULL) CheckHeap();
+
+	auto it = _largeObjects.find(addr);
+	if (it == _largeObjects.end()) return ERROR_MEM_ADDR_NOT_ALLOCATED;
+	if (g_heapCheckMode != HEAP_CHECK_OFF) {
+		CheckCookie(addr + static_cast<VirtPtr>(AlignUp(it->second.size, kCookieSize)));
+	}
+
+	_heapInUse -= it->second.size;
+	_freeCount++;
+	// StaticFree 同时移除 _largeObjects 中的记录
+	return StaticFree(addr);
+}
+
+// Growth stays within the span's slack when it can. Beyond it the span grows in place, or moves
+// to a new guest range still backed by the same host memory; bytes are only copied when the host
+// reservation cannot be extended.
+ErrorCode MemoryManager::LargeRealloc(VirtPtr* addr, size_t newSize)
+{
+	VirtPtr oldAddr = *addr;
+	LargeObject& object = _largeObjects.at(oldAddr);
+	size_t oldSize = object.size;
+	if (g_heapCheckMode != HEAP_CHECK_OFF) {
+		CheckCookie(oldAddr + static_cast<VirtPtr>(AlignUp(oldSize, kCookieSize)));
+	}
+	if (newSize > MEM_LARGE_HEAP_SIZE) return ERROR_MEM_ALLOC_FAIL;
+
+	MemoryBlock* block = object.block;
+	RealPtr realMemory = block->GetRAddr();
+	size_t need = AlignUp(newSize, kCookieSize) + kCookieSize;
+	if (need > block->GetSize()) {
+		size_t span = LargeSpanSize(newSize);
+		if (HostMemory::Extend(realMemory, span)) {
+			bool grows = oldAddr + span <= static_cast<uint64_t>(MEM_LARGE_HEAP_BASE) + MEM_LARGE_HEAP_SIZE
+				&& !OverlapsAnyMappedBlock(oldAddr + static_cast<VirtPtr>(block->GetSize()), span - block->GetSize());
+			VirtPtr newAddr = grows ? oldAddr : FindLargeSpan(span);
+			if (newAddr) {
+				LargeObject moved{ RemapBlock(block, newAddr, span), object.size };
+				_largeObjects.erase(oldAddr);
+				block = moved.block;
+				_largeObjects[newAddr] = moved;
+				*addr = newAddr;
+			}
+		}
+
+		if (need > block->GetSize()) {
+			// 无法重映射：分配新区间并拷贝已使用的部分
+			VirtPtr newAddr = 0;
+			ErrorCode err = DyanmicAlloc(&newAddr, newSize);
+			if (err != ERROR_OK) return err;
+			CopyChunks(GetRealAddr(newAddr), realMemory, oldSize);
+			LargeFree(oldAddr);
+			*addr = newAddr;
+			return ERROR_OK;
+		}
+	}
+	else {
+		// 缩小：交还尾部整块
+		size_t keep = AlignUp(need, HOST_COMMIT_CHUNK);
+		_heapTrimmed += HostMemory::Decommit(realMemory + keep, block->GetSize() - keep);
+	}
+
+	_largeObjects[*addr].size = static_cast<uint32_t>(newSize);
+	WriteCookie(*addr + static_cast<VirtPtr>(AlignUp(newSize, kCookieSize)));
+	_heapInUse -= oldSize;
+	AddHeapInUse(newSize);
+	return ERROR_OK;
+}
+
+// ====== 统计 ======
+
+void MemoryManager::CountAlloc(size_t size)
+{
+	_allocCount++;
+	_allocsBySize[std::bit_width(size) - 1]++;
+}
+
+HeapStats MemoryManager::GetHeapStats() const
+{
+	HeapStats stats = {};
+	stats.inUse = _heapInUse;
+	stats.peak = _heapPeak;
+	stats.trimmed = _heapTrimmed;
+
+	for (uint32_t fl = 0; fl < kHeapFlCount; fl++) {
+		if (!(_heapFlBitmap & (1u << fl))) continue;
+		for (uint32_t sl = 0; sl < kHeapSlCount; sl++) {
+			for (VirtPtr block = _heapFreeLists[fl][sl]; block; block = GetHeapBlock(block)->nextFree) {
+				uint32_t size = BlockSize(GetHeapBlock(block));
+				stats.freeBytes += size;
+				stats.freeBlocks++;
+				stats.largestFree = std::max<size_t>(stats.largestFree, size - kBlockOverhead);
+			}
+		}
+	}
+
+	stats.largeCount = static_cast<uint32_t>(_largeObjects.size());
+	for (const auto& object : _largeObjects) stats.largeInUse += object.second.size;
+
+	stats.allocs = _allocCount;
+	stats.frees = _freeCount;
+	stats.reallocs = _reallocCount;
+	stats.failures = _allocFailures;
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - _statsStart).count();
+	stats.allocsPerSecond = seconds > 0 ? _allocCount / seconds : 0;
+	memcpy(stats.allocsBySize, _allocsBySize, sizeof(_allocsBySize));
+	return stats;
+}
+
+void MemoryManager::DumpHeapStats(FILE* out) const
+{
+	HeapStats stats = GetHeapStats();
+	fprintf(out, "\n--- Heap ---\n");
+	fprintf(out, "in use:       %zu bytes (peak %zu), %zu of them in %u large allocations\n", stats.inUse, stats.peak, stats.largeInUse, stats.largeCount);
+	fprintf(out, "free:         %zu bytes in %u blocks, largest allocation possible %zu\n", stats.freeBytes, stats.freeBlocks, stats.largestFree);
+	fprintf(out, "trimmed:      %zu bytes\n", stats.trimmed);
+	fprintf(out, "allocations:  %llu (%.1f/s), %llu frees, %llu reallocations, %llu failed\n",
+		stats.allocs, stats.allocsPerSecond, stats.frees, stats.reallocs, stats.failures);
+
+	fprintf(out, "\n%-24s %12s\n", "Size", "Allocations");
+	for (uint32_t i = 0; i < 32; i++) {
+		if (!stats.allocsBySize[i]) continue;
+		char range[32];
+		snprintf(range, sizeof(range), "%llu-%llu", 1ull << i, (2ull << i) - 1);
+		fprintf(out, "%-24s %12llu\n", range, stats.allocsBySize[i]);
+	}
+}
+
 // ... [其它工具函数保持不变] ...
 bool MemoryManager::isVAddrAllocated(VirtPtr virtPtr)
 {
 	// 若在任一已映射块（包含虚拟堆）范围内，即视为已被占用（用于静态映射冲突检测）
-	for (auto block : _blocks) {
-		if (block->ContainsVAddr(virtPtr)) return true;
-	}
-	return false;
+	return LookupBlock(virtPtr) != nullptr;
 }
 
 RealPtr MemoryManager::GetRealAddr(VirtPtr virtPtr)
 {
-	for (auto block : _blocks) {
-		if (block->ContainsVAddr(virtPtr)) {
-			return block->GetRAddr(virtPtr);
-		}
-	}
-	return nullptr;
+	// Blocks are mapped whole, so any page of one translates at a fixed offset
+	MemoryBlock* block = LookupBlock(virtPtr);
+	if (!block) return nullptr;
+	return block->GetRAddr() + (virtPtr - block->GetVAddr());
 }
 
 VirtPtr MemoryManager::GetVirtualAddr(RealPtr realPtr)
 {
-	for (auto block : _blocks) {
-		if (block->ContainsRAddr(realPtr)) {
-			return block->GetVAddr(realPtr);
-		}
+	MemoryBlock* block = _lastHostBlock;
+	if (!block || realPtr < block->GetRAddr() || realPtr >= block->GetRAddr() + block->GetSize()) {
+		// The block with the highest host base not above realPtr is the only candidate
+		auto it = _hostBlocks.upper_bound(realPtr);
+		if (it == _hostBlocks.begin()) return 0x0;
+		block = std::prev(it)->second;
+		if (realPtr >= block->GetRAddr() + block->GetSize()) return 0x0;
+		_lastHostBlock = block;
 	}
-	return 0x0;
+	return block->GetVAddr() + static_cast<VirtPtr>(realPtr - block->GetRAddr());
 }
 
 size_t MemoryManager::GetAllocSize(VirtPtr addr)
 {
-	// 虚拟堆内的分配大小直接查 _heapAlloc
+	auto large = _largeObjects.find(addr);
+	if (large != _largeObjects.end()) {
+		return large->second.size;
+	}
+
+	// 虚拟堆内的分配大小由块头得出
 	if (HeapContains(addr)) {
-		auto it = _heapAlloc.find(addr);
-		if (it != _heapAlloc.end()) return it->second; // 返回用户可见大小
-		return 0;
+		VirtPtr block = addr - kBlockHeaderSize;
+		if (!IsAllocatedBlock(block)) return 0;
+		return BlockSize(GetHeapBlock(block)) - kBlockOverhead; // 返回用户可见大小
 	}
 
 	// 其它映射块：如支持子分配，可用 block->GetChunk(addr).GetSize()
 	// 默认视为不支持
 	return 0;
-}
\ No newline at end of file
+}
+
+MemoryBlock* MemoryManager::FindBlock(VirtPtr addr)
+{
+	MemoryBlock* block = LookupBlock(addr);
+	return block && block->GetVAddr() == addr ? block : nullptr;
+}
+
+// ====== Machine snapshots ======
+
+static bool IsZeroPage(const uint8_t* page)
+{
+	const uint64_t* words = reinterpret_cast<const uint64_t*>(page);
+	for (size_t i = 0; i < PAGE_SIZE / sizeof(uint64_t); i++) {
+		if (words[i]) return false;
+	}
+	return true;
+}
+
+// Uncommitted pages of demand-paged blocks read as zero; checking first keeps them uncommitted
+static bool IsBlankPage(uint8_t* page)
+{
+	return !HostMemory::IsCommitted(page) || IsZeroPage(page);
+}
+
+// Zeroes pages [first, end) without touching pages that are already zero, so untouched heap
+// memory stays uncommitted on the host
+static void ClearPages(uint8_t* data, uint32_t first, uint32_t end)
+{
+	for (uint32_t page = first; page < end; page++) {
+		uint8_t* p = data + static_cast<size_t>(page) * PAGE_SIZE;
+		if (!IsBlankPage(p)) memset(p, 0, PAGE_SIZE);
+	}
+}
+
+static void WritePageRun(SnapshotWriter& writer, const uint8_t* data, uint32_t first, uint32_t count)
+{
+	writer.Write<uint32_t>(first);
+	writer.Write<uint32_t>(count);
+	writer.WriteBytes(data + static_cast<size_t>(first) * PAGE_SIZE, static_cast<size_t>(count) * PAGE_SIZE);
+}
+
+void MemoryManager::SaveSnapshot(SnapshotWriter& writer, bool incremental)
+{
+	// Heap metadata leads, so a restore that can skip the page data still finds it. Block headers
+	// are in guest memory; only the free list heads and their bitmaps live on the host.
+	writer.Write<uint32_t>(_heapFlBitmap);
+	writer.WriteBytes(_heapSlBitmap, sizeof(_heapSlBitmap));
+	writer.WriteBytes(_heapFreeLists, sizeof(_heapFreeLists));
+	writer.Write<uint64_t>(_heapInUse);
+	writer.Write<uint64_t>(_heapPeak);
+	// Large allocations; their blocks follow with the others
+	writer.Write<uint32_t>(static_cast<uint32_t>(_largeObjects.size()));
+	for (const auto& object : _largeObjects) {
+		writer.Write<uint32_t>(object.first);
+		writer.Write<uint32_t>(object.second.size);
+		writer.Write<uint32_t>(static_cast<uint32_t>(object.second.block->GetSize()));
+	}
+
+	std::vector<MemoryBlock*> blocks(_blocks.begin(), _blocks.end());
+	std::sort(blocks.begin(), blocks.end(), [](MemoryBlock* a, MemoryBlock* b) { return a->GetVAddr() < b->GetVAddr(); });
+
+	writer.Write<uint32_t>(static_cast<uint32_t>(blocks.size()));
+	for (auto block : blocks) {
+		uint8_t* data = block->GetRAddr();
+		uint32_t pageCount = block->GetPageCount();
+		// Blocks mapped since the baseline have nothing to be relative to and are saved whole
+		bool delta = incremental && HostMemory::IsTracked(block->GetRAddr());
+		writer.Write<uint32_t>(block->GetVAddr());
+		writer.Write<uint32_t>(pageCount);
+		writer.Write<uint8_t>(delta);
+
+		if (delta) {
+			// Pages written since the baseline, zero or not; the rest are as in the base snapshot
+			std::vector<uint32_t> dirty = HostMemory::GetDirtyPages(block->GetRAddr());
+			for (size_t i = 0; i < dirty.size();) {
+				size_t j = i + 1;
+				while (j < dirty.size() && dirty[j] == dirty[j - 1] + 1) j++;
+				// Trimmed pages are dirty too; fwrite cannot fault them back in
+				HostMemory::Commit(data + static_cast<size_t>(dirty[i]) * PAGE_SIZE, (j - i) * PAGE_SIZE);
+				WritePageRun(writer, data, dirty[i], static_cast<uint32_t>(j - i));
+				i = j;
+			}
+		}
+		else {
+			// Only runs of non-zero pages are stored; most of the heap is never written
+			for (uint32_t page = 0; page < pageCount;) {
+				if (IsBlankPage(data + static_cast<size_t>(page) * PAGE_SIZE)) {
+					page++;
+					continue;
+				}
+				uint32_t first = page;
+				while (page < pageCount && !IsBlankPage(data + static_cast<size_t>(page) * PAGE_SIZE)) page++;
+				WritePageRun(writer, data, first, page - first);
+			}
+		}
+		// An empty run ends the block
+		writer.Write<uint32_t>(0);
+		writer.Write<uint32_t>(0);
+	}
+}
+
+void MemoryManager::RestoreSnapshot(SnapshotReader& reader, bool skipBaselineBlocks)
+{
+	_heapFlBitmap = reader.Read<uint32_t>();
+	reader.ReadBytes(_heapSlBitmap, sizeof(_heapSlBitmap));
+	reader.ReadBytes(_heapFreeLists, sizeof(_heapFreeLists));
+	_heapInUse = static_cast<size_t>(reader.Read<uint64_t>());
+	_heapPeak = static_cast<size_t>(reader.Read<uint64_t>());
+
+	// Large allocations get demand-paged blocks before the block list below fills them. Ones
+	// that already sit at the same place with the same span are kept, so they stay tracked.
+	std::map<VirtPtr, std::pair<uint32_t, uint32_t>> large; // addr -> size, span
+	uint32_t largeCount = reader.Read<uint32_t>();
+	for (uint32_t i = 0; i < largeCount && reader.Ok(); i++) {
+		VirtPtr vaddr = reader.Read<uint32_t>();
+		uint32_t size = reader.Read<uint32_t>();
+		uint32_t span = reader.Read<uint32_t>();
+		large[vaddr] = { size, span };
+	}
+	if (!reader.Ok()) return;
+
+	std::vector<VirtPtr> replaced;
+	for (const auto& object : _largeObjects) {
+		auto it = large.find(object.first);
+		if (it == large.end() || it->second.second != object.second.block->GetSize()) replaced.push_back(object.first);
+	}
+	for (VirtPtr vaddr : replaced) StaticFree(vaddr);
+	for (const auto& entry : large) {
+		auto it = _largeObjects.find(entry.first);
+		if (it != _largeObjects.end()) {
+			it->second.size = entry.second.first;
+			continue;
+		}
+		MemoryBlock* block = nullptr;
+		if (DemandAlloc(entry.first, entry.second.second, &block) != ERROR_OK) {
+			reader.Fail("cannot map large allocation");
+			return;
+		}
+		_largeObjects[entry.first] = LargeObject{ block, entry.second.first };
+	}
+
+	std::unordered_set<MemoryBlock*> restored;
+
+	uint32_t blockCount = reader.Read<uint32_t>();
+	for (uint32_t i = 0; i < blockCount && reader.Ok(); i++) {
+		VirtPtr vaddr = reader.Read<uint32_t>();
+		uint32_t pageCount = reader.Read<uint32_t>();
+		bool delta = reader.Read<uint8_t>() != 0;
+		if (!reader.Ok()) return;
+
+		// Blocks the executable loader already mapped are reused; the rest are mapped again
+		MemoryBlock* block = FindBlock(vaddr);
+		if (block && block->GetPageCount() != pageCount) {
+			reader.Fail("memory block size differs from the loaded executable");
+			return;
+		}
+		bool tracked = block && HostMemory::IsTracked(block->GetRAddr());
+		if (delta && !tracked) {
+			reader.Fail("incremental snapshot does not match the loaded baseline");
+			return;
+		}
+		if (!block && StaticAlloc(vaddr, static_cast<size_t>(pageCount) * PAGE_SIZE, &block) != ERROR_OK) {
+			reader.Fail("cannot map memory block");
+			return;
+		}
+		restored.insert(block);
+
+		// Already reverted to exactly these contents
+		bool skip = !delta && tracked && skipBaselineBlocks;
+
+		uint8_t* data = block->GetRAddr();
+		uint32_t next = 0;
+		for (;;) {
+			uint32_t first = reader.Read<uint32_t>();
+			uint32_t count = reader.Read<uint32_t>();
+			if (!reader.Ok()) return;
+			if (count == 0) break;
+			if (first < next || static_cast<uint64_t>(first) + count > pageCount) {
+				reader.Fail("page run out of range");
+				return;
+			}
+			if (skip) {
+				reader.Skip(static_cast<size_t>(count) * PAGE_SIZE);
+			}
+			else {
+				if (!delta) ClearPages(data, next, first);
+				// fread cannot fault a page in, be it write-protected or uncommitted
+				if (tracked) HostMemory::PrepareWrite(data + static_cast<size_t>(first) * PAGE_SIZE, static_cast<size_t>(count) * PAGE_SIZE);
+				else HostMemory::Commit(data + static_cast<size_t>(first) * PAGE_SIZE, static_cast<size_t>(count) * PAGE_SIZE);
+				reader.ReadBytes(data + static_cast<size_t>(first) * PAGE_SIZE, static_cast<size_t>(count) * PAGE_SIZE);
+			}
+			next = first + count;
+		}
+		if (!delta && !skip) ClearPages(data, next, pageCount);
+	}
+	if (!reader.Ok()) return;
+
+	// Static blocks the snapshot does not know about
+	std::vector<VirtPtr> stale;
+	for (auto block : _blocks) {
+		if (block != _dynamicHeapBlock && !restored.count(block)) stale.push_back(block->GetVAddr());
+	}
+	for (VirtPtr vaddr : stale) StaticFree(vaddr);
+}
+
+void MemoryManager::MarkBaseline()
+{
+	_baselineBlocks.clear();
+	for (auto block : _blocks) {
+		HostMemory::Track(block->GetRAddr(), block->GetSize());
+		_baselineBlocks.push_back(block->GetVAddr());
+	}
+	HostMemory::ClearDirty();
+	_hasBaseline = true;
+}
+
+void MemoryManager::DropBaseline()
+{
+	for (auto block : _blocks) HostMemory::Untrack(block->GetRAddr());
+	_baselineBlocks.clear();
+	_hasBaseline = false;
+}
+
+bool MemoryManager::RevertToBaseline()
+{
+	if (!_hasBaseline) return false;
+
+	// A baseline block that was unmapped since has lost its contents
+	for (VirtPtr vaddr : _baselineBlocks) {
+		MemoryBlock* block = FindBlock(vaddr);
+		if (!block || !HostMemory::IsTracked(block->GetRAddr())) return false;
+	}
+	HostMemory::Revert();
+	return true;
+}
+
+void MemoryManager::PrepareHostWrite(VirtPtr addr, size_t size)
+{
+	RealPtr realAddr = GetRealAddr(addr);
+	if (!realAddr) return;
+	if (_hasBaseline) HostMemory::PrepareWrite(realAddr, size);
+	else HostMemory::Commit(realAddr, size);
+}
+
+void MemoryManager::PrepareHostRead(VirtPtr addr, size_t size)
+{
+	RealPtr realAddr = GetRealAddr(addr);
+	if (realAddr) HostMemory::Commit(realAddr, size);
+}
@@ -3,16 +3,59 @@
 
 #include <unordered_set>
 #include <unordered_map>
+#include <chrono>
+#include <cstdio>
 #include <map>
+#include <memory>
+#include <string>
+#include <vector>
 #include <stdexcept>
 
 #include "MemoryBlock.h"
 #include "MemoryChunk.h"
 
+class SnapshotWriter;
+class SnapshotReader;
+struct HeapBlock;
+
+// How much of the heap's cookies are validated; a bad cookie aborts with the corrupt address
+enum HeapCheckMode
+{
+    HEAP_CHECK_OFF,     // cookies are still written, but never checked
+    HEAP_CHECK_FREED,   // the block being freed or resized only
+    HEAP_CHECK_SAMPLED, // plus every live allocation, once per interval between time slices
+    HEAP_CHECK_FULL,    // every live allocation on every free; frees cost O(live allocations)
+};
+
+// Dynamic heap telemetry, from MemoryManager::GetHeapStats
+struct HeapStats
+{
+    size_t inUse;         // user bytes, large allocations included
+    size_t peak;
+    size_t freeBytes;     // free blocks of the heap, headers included
+    uint32_t freeBlocks;
+    size_t largestFree;   // largest allocation the heap itself can satisfy now
+    uint32_t largeCount;  // live large allocations
+    size_t largeInUse;
+    size_t trimmed;       // host memory given back, in total
+    // Since start; a reallocation that moves also counts as an allocation and a free
+    uint64_t allocs;
+    uint64_t frees;
+    uint64_t reallocs;
+    uint64_t failures;
+    double allocsPerSecond;
+    // Allocations by requested size: [1 << i, 2 << i) bytes
+    uint64_t allocsBySize[32];
+};
+
 // 预分配的动态堆（虚拟堆）位置与大小
 constexpr VirtPtr MEM_DYNAMIC_HEAP_BASE = 0x20000000;
 constexpr size_t  MEM_DYNAMIC_HEAP_SIZE = 0x10000000; // 32MB
 
+// Large allocations get a demand-paged span of their own here, with slack to grow into
+constexpr VirtPtr MEM_LARGE_HEAP_BASE = 0x60000000;
+constexpr size_t  MEM_LARGE_HEAP_SIZE = 0x10000000;
+
 class MemoryManager
 {
 public:
@@ -25,7 +68,17 @@ public:
 
     // 静态映射：将一段主机内存映射到指定虚拟地址区间（一次性映射，不做子分配）
     ErrorCode StaticAlloc(VirtPtr addr, size_t size, MemoryBlock** memoryBlock = nullptr);
+    // Like StaticAlloc, but backed by [offset, offset + size) of a file, mapped copy-on-write: the
+    // guest can write to it, the file is never modified. offset is a multiple of PAGE_SIZE.
+    ErrorCode MapFile(VirtPtr addr, const std::string& path, uint64_t offset, size_t size, MemoryBlock** memoryBlock = nullptr);
+    // Like StaticAlloc, but host memory is only reserved: each HOST_COMMIT_CHUNK is committed and
+    // mapped into the engine on first access, through MapDemandChunk. addr and size are multiples
+    // of HOST_COMMIT_CHUNK, otherwise this maps the block whole.
+    ErrorCode DemandAlloc(VirtPtr addr, size_t size, MemoryBlock** memoryBlock = nullptr);
     ErrorCode StaticFree(VirtPtr addr);
+    // Called from the engine's unmapped-access hook; maps the chunk holding addr if it belongs
+    // to a demand-paged block and is not mapped yet, so the access can be retried
+    bool MapDemandChunk(VirtPtr addr);
 
     void WriteCookie(VirtPtr addr);
 
@@ -40,6 +93,51 @@ public:
 
     size_t GetAllocSize(VirtPtr addr);
 
+    // The block mapped exactly at `addr`, or nullptr
+    MemoryBlock* FindBlock(VirtPtr addr);
+
+    // Static, so it can be chosen before the first use creates the instance. Defaults to
+    // HEAP_CHECK_FULL in debug builds and HEAP_CHECK_FREED otherwise.
+    static void SetHeapCheck(HeapCheckMode mode);
+    static void SetHeapCheckInterval(uint32_t intervalMs);
+    // Validates the cookies of every live allocation
+    void CheckHeap();
+    // Called by the executor between time slices; sweeps when HEAP_CHECK_SAMPLED is due
+    void PeriodicHeapCheck();
+    // Likewise; every few seconds gives the host memory under free heap spans back to the OS.
+    // Spans of kHeapTrimThreshold or more are trimmed as soon as they are freed.
+    void PeriodicHeapTrim();
+
+    // Bytes currently handed out by the dynamic heap and large allocations (excluding cookies) and
+    // the high-water mark
+    size_t GetHeapInUse() const { return _heapInUse; }
+    size_t GetHeapPeak() const { return _heapPeak; }
+    // Host memory given back by trimming free heap spans, in total
+    size_t GetHeapTrimmed() const { return _heapTrimmed; }
+    // Walks the free lists, so only between time slices or once the engine is stopped
+    HeapStats GetHeapStats() const;
+    void DumpHeapStats(FILE* out) const;
+
+    // Machine snapshots: the heap metadata, then every mapped block as runs of non-zero pages.
+    // Restoring maps blocks the snapshot has and unmaps static blocks it does not.
+    // Incremental: blocks tracked since MarkBaseline only carry the pages written since.
+    // skipBaselineBlocks: memory was just reverted to this very snapshot, so whole tracked blocks
+    // are skipped instead of copied.
+    void SaveSnapshot(SnapshotWriter& writer, bool incremental);
+    void RestoreSnapshot(SnapshotReader& reader, bool skipBaselineBlocks);
+
+    // Dirty page tracking for incremental snapshots and fast resets. MarkBaseline write-protects
+    // every block; pages written afterwards are recorded, and RevertToBaseline copies just those
+    // back. Fails if a baseline block was unmapped since.
+    void MarkBaseline();
+    void DropBaseline();
+    bool HasBaseline() const { return _hasBaseline; }
+    bool RevertToBaseline();
+    // Must precede host OS writes into guest memory (e.g. fread), as those cannot be tracked by faults
+    void PrepareHostWrite(VirtPtr addr, size_t size);
+    // Likewise host OS reads (e.g. fwrite), which fail on uncommitted pages of demand-paged blocks
+    void PrepareHostRead(VirtPtr addr, size_t size);
+
 private:
     MemoryManager();
     ~MemoryManager();
@@ -53,15 +151,70 @@ private:
     MemoryBlock* _dynamicHeapBlock = nullptr;
     size_t       _heapSize = 0;
 
-    // 简单的虚拟堆元数据：有序自由表 + 已分配表
-    // 自由表使用按地址排序的 map，便于邻接块合并
-    std::map<VirtPtr, size_t>           _heapFree;   // key=start, value=size
-    std::unordered_map<VirtPtr, size_t> _heapAlloc;  // key=start, value=size
+    // 虚拟堆元数据：TLSF（两级分离适配）
+    // Every heap block starts with a header in guest memory (see MemoryManager.cpp). Free blocks
+    // are linked into one list per size class; the first level splits sizes by power of two, the
+    // second into kHeapSlCount linear steps, and a bitmap per level finds the smallest non-empty
+    // class that fits with two bit scans.
+    static constexpr uint32_t kHeapSlLog2 = 4;
+    static constexpr uint32_t kHeapSlCount = 1u << kHeapSlLog2;
+    static constexpr uint32_t kHeapFlShift = kHeapSlLog2 + 4; // below 1 << kHeapFlShift classes are linear
+    static constexpr uint32_t kHeapFlCount = 32 - kHeapFlShift + 1;
+    uint32_t _heapFlBitmap = 0;
+    uint32_t _heapSlBitmap[kHeapFlCount] = {};
+    VirtPtr  _heapFreeLists[kHeapFlCount][kHeapSlCount] = {};
 
     std::unordered_set<MemoryBlock*> _blocks;
+    // Allocations of kLargeAllocThreshold bytes or more: user pointer -> block spanning the
+    // allocation and its slack. The suffix cookie follows the user data; there is no prefix.
+    struct LargeObject
+    {
+        MemoryBlock* block;
+        uint32_t size;
+    };
+    std::map<VirtPtr, LargeObject> _largeObjects;
+    // Demand-paged blocks -> which of their chunks are mapped in the engine
+    std::unordered_map<MemoryBlock*, std::vector<uint8_t>> _demandBlocks;
+
+    // Guest page -> block, as two levels of 1024 entries so a lookup is two loads. Second-level
+    // tables are created when a block is first mapped into their 4MB range.
+    static constexpr uint32_t kPageTableBits = 10;
+    static constexpr uint32_t kPageTableSize = 1u << kPageTableBits;
+    std::unique_ptr<MemoryBlock*[]> _pageTable[kPageTableSize];
+    // Host base -> block for GetVirtualAddr; the last hit is tried first, as lookups cluster
+    std::map<RealPtr, MemoryBlock*> _hostBlocks;
+    MemoryBlock* _lastHostBlock = nullptr;
+
+    void IndexBlock(MemoryBlock* block, MemoryBlock* entry);
+    MemoryBlock* LookupBlock(VirtPtr addr) const {
+        uint32_t page = addr / PAGE_SIZE;
+        const std::unique_ptr<MemoryBlock*[]>& table = _pageTable[page >> kPageTableBits];
+        return table ? table[page & (kPageTableSize - 1)] : nullptr;
+    }
+
+    bool _hasBaseline = false;
+    std::vector<VirtPtr> _baselineBlocks;
+
+    size_t _heapInUse = 0;
+    size_t _heapPeak = 0;
+    size_t _heapTrimmed = 0;
+
+    std::chrono::steady_clock::time_point _statsStart = std::chrono::steady_clock::now();
+    uint64_t _allocCount = 0;
+    uint64_t _freeCount = 0;
+    uint64_t _reallocCount = 0;
+    uint64_t _allocFailures = 0;
+    uint64_t _allocsBySize[32] = {};
+    void CountAlloc(size_t size);
+    void AddHeapInUse(size_t size) {
+        _heapInUse += size;
+        if (_heapInUse > _heapPeak) _heapPeak = _heapInUse;
+    }
 
     // 辅助函数
     static constexpr size_t kHeapAlign = 16;
+    static constexpr uint32_t kHeapTrimThreshold = 0x100000;
+    static constexpr uint32_t kLargeAllocThreshold = 0x10000;
 
     static inline size_t AlignUp(size_t v, size_t a) {
         return (v + (a - 1)) & ~(a - 1);
@@ -73,15 +226,11 @@ private:
         return (a >= base) && (a < base + _heapSize);
     }
 
-    inline bool RangeOverlaps(VirtPtr a1, size_t s1, VirtPtr a2, size_t s2) const {
-        if (s1 == 0 || s2 == 0) return false;
-        uint64_t b1 = static_cast<uint64_t>(a1);
-        uint64_t e1 = b1 + static_cast<uint64_t>(s1);
-        uint64_t b2 = static_cast<uint64_t>(a2);
-        uint64_t e2 = b2 + static_cast<uint64_t>(s2);
-        return !(e1 <= b2 || e2 <= b1);
-    }
-
+    ErrorCode MapBlock(VirtPtr addr, RealPtr realMemory, uint32_t pageCount, MemoryBlock** memoryBlock);
+    bool UnmapBlock(MemoryBlock* block);
+    // Moves a demand-paged block to [addr, addr + size) in the guest, keeping its host memory,
+    // which must already cover size; returns the block replacing it
+    MemoryBlock* RemapBlock(MemoryBlock* block, VirtPtr addr, size_t size);
     bool OverlapsAnyMappedBlock(VirtPtr addr, size_t size) const;
 
     void CheckCookie(VirtPtr addr);
@@ -89,8 +238,26 @@ private:
     // 虚拟堆子分配/释放/合并
     ErrorCode HeapAlloc(VirtPtr* out, size_t size);
     ErrorCode HeapFree(VirtPtr addr);
-    bool TryHeapReallocInPlace(VirtPtr addr, size_t oldSize, size_t newSize);
-    void CoalesceAround(VirtPtr start, size_t size);
+    bool TryHeapReallocInPlace(VirtPtr addr, size_t newSize);
+
+    // 大块分配：独立的按需分页区间
+    static size_t LargeSpanSize(size_t size);
+    VirtPtr FindLargeSpan(size_t span);
+    ErrorCode LargeAlloc(VirtPtr* out, size_t size);
+    ErrorCode LargeFree(VirtPtr addr);
+    ErrorCode LargeRealloc(VirtPtr* addr, size_t newSize);
+
+    // TLSF 内部操作；block 为块头的虚拟地址
+    HeapBlock* GetHeapBlock(VirtPtr block) const;
+    bool IsAllocatedBlock(VirtPtr block) const;
+    static void MapHeapSize(uint32_t size, uint32_t* fl, uint32_t* sl);
+    VirtPtr FindFreeBlock(uint32_t size);
+    void InsertFreeBlock(VirtPtr block);
+    void RemoveFreeBlock(VirtPtr block);
+    void SetBlockSize(VirtPtr block, uint32_t size, bool free);
+    VirtPtr ReleaseBlock(VirtPtr block, uint32_t size);
+    void TrimFreeBlock(VirtPtr block);
+    void SplitBlock(VirtPtr block, uint32_t size);
 };
 
 #define sMemoryManager MemoryManager::GetInstance()
@@ -9,6 +9,7 @@
 #include "common.h"
 #include "MemoryManager.h"
 #include "PELoader.h"
+#include "Snapshot.h"
 #include <windows.h>
 #include <fstream>
 #include <vector>
@@ -447,6 +448,73 @@ std::shared_ptr<PEImage> GetPEImageByHandle(uint32_t handle) {
     return nullptr;
 }
 
+std::vector<std::shared_ptr<PEImage>> GetLoadedPEImages() {
+    std::vector<std::shared_ptr<PEImage>> images;
+    for (const auto& pair : g_loadedPEImages) {
+        if (pair.second) images.push_back(pair.second);
+    }
+    return images;
+}
+
+void SavePEImageSnapshot(SnapshotWriter& writer) {
+    auto images = GetLoadedPEImages();
+    writer.Write<uint32_t>((uint32_t)images.size());
+    for (const auto& img : images) {
+        writer.WriteString(img->path);
+        writer.Write<uint32_t>(img->preferredImageBase);
+        writer.Write<uint32_t>(img->actualImageBase);
+        writer.Write<uint32_t>(img->sizeOfImage);
+        writer.Write<uint32_t>((uint32_t)img->blocks.size());
+        for (const auto& b : img->blocks) {
+            writer.Write<uint32_t>(b.vaddr);
+            writer.Write<uint32_t>(b.size);
+        }
+        writer.Write<uint32_t>((uint32_t)img->exportsByName.size());
+        for (const auto& e : img->exportsByName) {
+            writer.WriteString(e.first);
+            writer.Write<uint32_t>(e.second);
+        }
+        writer.Write<uint32_t>((uint32_t)img->exportsByOrdinal.size());
+        for (const auto& e : img->exportsByOrdinal) {
+            writer.Write<uint32_t>(e.first);
+            writer.Write<uint32_t>(e.second);
+        }
+    }
+}
+
+void RestorePEImageSnapshot(SnapshotReader& reader) {
+    g_loadedPEImages.clear();
+    uint32_t count = reader.Read<uint32_t>();
+    for (uint32_t i = 0; i < count && reader.Ok(); i++) {
+        auto img = std::make_shared<PEImage>();
+        img->path = reader.ReadString();
+        img->preferredImageBase = reader.Read<uint32_t>();
+        img->actualImageBase = reader.Read<uint32_t>();
+        img->sizeOfImage = reader.Read<uint32_t>();
+        uint32_t blockCount = reader.Read<uint32_t>();
+        for (uint32_t j = 0; j < blockCount && reader.Ok(); j++) {
+            PEImage::BlockInfo b;
+            b.vaddr = reader.Read<uint32_t>();
+            b.size = reader.Read<uint32_t>();
+            b.block = sMemoryManager->FindBlock(b.vaddr);
+            if (!b.block) reader.Fail("module block is not mapped");
+            img->blocks.push_back(b);
+        }
+        uint32_t nameCount = reader.Read<uint32_t>();
+        for (uint32_t j = 0; j < nameCount && reader.Ok(); j++) {
+            std::string name = reader.ReadString();
+            img->exportsByName[name] = reader.Read<uint32_t>();
+        }
+        uint32_t ordinalCount = reader.Read<uint32_t>();
+        for (uint32_t j = 0; j < ordinalCount && reader.Ok(); j++) {
+            uint32_t ordinal = reader.Read<uint32_t>();
+            img->exportsByOrdinal[ordinal] = reader.Read<uint32_t>();
+        }
+        // Keyed like MapPEIntoMemory: lowercase file name
+        g_loadedPEImages[ToLower(fs::path(img->path).filename().string())] = img;
+    }
+}
+
 // End of loader
 
 // -------------------------- Integration note --------------------------
@@ -6,6 +6,9 @@
 #include <unordered_map>
 #include <memory>
 #include "MemoryBlock.h"
+
+class SnapshotWriter;
+class SnapshotReader;
 // Representation for a mapped image
 struct PEImage {
     std::string path;
@@ -23,6 +26,11 @@ struct PEImage {
 ErrorCode LoadPEImage(const std::string& path, PEImage& outImg, const std::string& systemDir);
 
 std::shared_ptr<PEImage> GetPEImageByHandle(uint32_t handle);
+// Every module mapped so far (executable and DLLs)
+std::vector<std::shared_ptr<PEImage>> GetLoadedPEImages();
+// Machine snapshots: the module table, with blocks resolved against the restored memory map
+void SavePEImageSnapshot(SnapshotWriter& writer);
+void RestorePEImageSnapshot(SnapshotReader& reader);
 
 inline std::string ToLower(const std::string& s) {
     std::string r = s;
@@ -5,15 +5,132 @@
 #include "stdafx.h"
 #include "executable.h"
 #include "executor.h"
+#include "SystemAPI.h"
+#include "ThreadHandler.h"
+#include "GuestClock.h"
+#include "Profiler.h"
+#include "BlockHistogram.h"
+#include "Symbols.h"
+#include "Snapshot.h"
+#include "MemoryManager.h"
+
+#include <cstring>
+#include <cstdlib>
+#include <string>
+#include <windows.h>
+
+static std::string g_snapshotPath;
+// Set once main has printed the exit statistics
+static HANDLE g_exitReported = nullptr;
+
+// Ctrl+Break prints the system call statistics, block histogram and heap statistics, writes the
+// profile so far and saves a snapshot if one was asked for. Ctrl+C and closing the console stop
+// the emulator and wait for the same report on the way out. Statistics owned by the emulator
+// thread are printed by it, never from this handler's thread.
+static BOOL WINAPI ConsoleCtrlHandler(DWORD ctrlType)
+{
+    switch (ctrlType)
+    {
+    case CTRL_BREAK_EVENT:
+        if (!g_snapshotPath.empty())
+            sExecutor->RequestSnapshot(g_snapshotPath);
+        sExecutor->RequestStats();
+        sProfiler->Flush();
+        return TRUE;
+    case CTRL_C_EVENT:
+    case CTRL_CLOSE_EVENT:
+        // Windows ends the process a few seconds after a close event regardless
+        sExecutor->RequestStop();
+        if (g_exitReported)
+            WaitForSingleObject(g_exitReported, 4000);
+        return FALSE;
+    default:
+        return FALSE;
+    }
+}
+
+static void PrintUsage(const char* name)
+{
+    printf("Usage: %s armfir.elf [options]\n", name);
+    printf("    --preempt=timer    slice threads with a host timer, no engine callbacks (default)\n");
+    printf("    --preempt=count    slice threads by instruction budget, reproducible but slower\n");
+    printf("    --clock=real       guest time follows host time (default)\n");
+    printf("    --clock=virtual    guest time advances with executed slices, skipping idle waits\n");
+    printf("    --turbo            complete guest sleeps at once whenever no thread is ready\n");
+    printf("    --bench-switch     measure thread context switch cost and exit\n");
+    printf("    --profile=FILE     sample guest stacks and write them to FILE as collapsed stacks\n");
+    printf("    --profile-interval=US  sampling interval in microseconds (default 1000)\n");
+    printf("    --symbols=FILE     extra address/name map used to symbolize the profile\n");
+    printf("    --block-histogram[=N]  count executions per basic block and print the N hottest (default 20)\n");
+    printf("    --restore=FILE     start from a machine snapshot instead of booting\n");
+    printf("    --save-snapshot=FILE  save a machine snapshot to FILE on Ctrl+Break\n");
+    printf("    --heap-check=off|freed|sampled|full  heap cookies validated: none, the freed block (default),\n");
+    printf("                       plus every allocation once per interval, or every allocation on every free\n");
+    printf("    --heap-check-interval=MS  sweep interval for --heap-check=sampled (default 1000)\n");
+}
 
 int main(int argc, char** argv)
 {
-    if (argc != 2)
+    bool benchSwitch = false;
+    std::string profilePath;
+    uint32_t profileInterval = 1000;
+    uint32_t histogramBlocks = 0;
+    std::string restorePath;
+
+    if (argc < 2)
     {
-        printf("Usage: %s armfir.elf\n", argv[0]);
+        PrintUsage(argv[0]);
         return 1;
     }
 
+    for (int i = 2; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--preempt=count") == 0)
+            sExecutor->SetPreemptionMode(PREEMPT_INSTRUCTION_COUNT);
+        else if (strcmp(argv[i], "--preempt=timer") == 0)
+            sExecutor->SetPreemptionMode(PREEMPT_HOST_TIMER);
+        else if (strcmp(argv[i], "--clock=real") == 0)
+            GuestClock::SetMode(GuestClock::GUEST_CLOCK_REALTIME);
+        else if (strcmp(argv[i], "--clock=virtual") == 0)
+            GuestClock::SetMode(GuestClock::GUEST_CLOCK_VIRTUAL);
+        else if (strcmp(argv[i], "--turbo") == 0)
+            sThreadHandler->SetTurbo(true);
+        else if (strcmp(argv[i], "--bench-switch") == 0)
+            benchSwitch = true;
+        else if (strncmp(argv[i], "--profile=", 10) == 0)
+            profilePath = argv[i] + 10;
+        else if (strncmp(argv[i], "--profile-interval=", 19) == 0)
+            profileInterval = static_cast<uint32_t>(strtoul(argv[i] + 19, nullptr, 0));
+        else if (strcmp(argv[i], "--block-histogram") == 0)
+            histogramBlocks = 20;
+        else if (strncmp(argv[i], "--block-histogram=", 18) == 0)
+            histogramBlocks = static_cast<uint32_t>(strtoul(argv[i] + 18, nullptr, 0));
+        else if (strncmp(argv[i], "--restore=", 10) == 0)
+            restorePath = argv[i] + 10;
+        else if (strncmp(argv[i], "--save-snapshot=", 16) == 0)
+            g_snapshotPath = argv[i] + 16;
+        else if (strcmp(argv[i], "--heap-check=off") == 0)
+            MemoryManager::SetHeapCheck(HEAP_CHECK_OFF);
+        else if (strcmp(argv[i], "--heap-check=freed") == 0)
+            MemoryManager::SetHeapCheck(HEAP_CHECK_FREED);
+        else if (strcmp(argv[i], "--heap-check=sampled") == 0)
+            MemoryManager::SetHeapCheck(HEAP_CHECK_SAMPLED);
+        else if (strcmp(argv[i], "--heap-check=full") == 0)
+            MemoryManager::SetHeapCheck(HEAP_CHECK_FULL);
+        else if (strncmp(argv[i], "--heap-check-interval=", 22) == 0)
+            MemoryManager::SetHeapCheckInterval(static_cast<uint32_t>(strtoul(argv[i] + 22, nullptr, 0)));
+        else if (strncmp(argv[i], "--symbols=", 10) == 0)
+        {
+            if (!sSymbols->LoadMapFile(argv[i] + 10))
+                printf("Cannot read symbol map %s\n", argv[i] + 10);
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+
     Executable exec(argv[1]);
 
     if (exec.get_state() == EXEC_LOAD_FAILED)
@@ -28,7 +145,36 @@ int main(int argc, char** argv)
         return 1;
     }
 
+    if (!restorePath.empty() && !RestoreSnapshot(restorePath))
+    {
+        sExecutor->Cleanup();
+        return 1;
+    }
+
+    g_exitReported = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+    SetConsoleCtrlHandler(ConsoleCtrlHandler, TRUE);
+
+    if (benchSwitch)
+    {
+        sThreadHandler->BenchmarkContextSwitch(100000);
+        sExecutor->Cleanup();
+        return 0;
+    }
+
+    if (!profilePath.empty())
+        sProfiler->Start(profileInterval, profilePath);
+    if (histogramBlocks)
+        sBlockHistogram->Attach(sExecutor->GetUcInstance(), histogramBlocks);
+
     sExecutor->Execute();
+    sProfiler->Stop();
+    sProfiler->Flush();
+    sSystemAPI->DumpStats(stdout);
+    sBlockHistogram->Dump(stdout);
+    sBlockHistogram->Detach();
+    sMemoryManager->DumpHeapStats(stdout);
+    fflush(stdout);
+    SetEvent(g_exitReported);
     sExecutor->Cleanup();
     getchar();
 
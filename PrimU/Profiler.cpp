@@ -0,0 +1,138 @@
+#include "Profiler.h"
+#include "executor.h"
+#include "Symbols.h"
+
+#include <chrono>
+#include <unordered_map>
+
+Profiler* Profiler::_instance = nullptr;
+
+static bool TryRead32(uc_engine* uc, uint32_t addr, uint32_t* out)
+{
+    return uc_mem_read(uc, addr, out, sizeof(uint32_t)) == UC_ERR_OK;
+}
+
+// BL/BLX is 4 bytes in ARM state; in Thumb the 2-byte step lands inside the call instruction either way
+static uint32_t CallSite(uint32_t returnAddress)
+{
+    return (returnAddress & ~1u) - ((returnAddress & 1u) ? 2u : 4u);
+}
+
+int UnwindGuestStack(uc_engine* uc, uint32_t pc, uint32_t lr, uint32_t fp, uint32_t* frames, int maxFrames)
+{
+    int count = 0;
+    if (count < maxFrames)
+        frames[count++] = pc & ~1u;
+    if (lr && count < maxFrames)
+        frames[count++] = CallSite(lr);
+
+    uint32_t lastFp = 0;
+    while (count < maxFrames && fp != 0 && fp != lastFp) {
+        uint32_t prevFp = 0, savedLr = 0;
+        if (!TryRead32(uc, fp - 4, &prevFp) || !TryRead32(uc, fp, &savedLr))
+            break;
+        if (savedLr)
+            frames[count++] = CallSite(savedLr);
+        lastFp = fp;
+        fp = prevFp;
+    }
+    return count;
+}
+
+void Profiler::Start(uint32_t intervalMicros, const std::string& outputPath)
+{
+    if (_running)
+        return;
+
+    _intervalMicros = intervalMicros ? intervalMicros : 1;
+    _outputPath = outputPath;
+    _running = true;
+    _timerThread = std::thread(&Profiler::TimerProc, this);
+}
+
+void Profiler::Stop()
+{
+    if (!_running)
+        return;
+
+    _running = false;
+    _timerThread.join();
+    _sampleRequested = false;
+}
+
+void Profiler::TimerProc()
+{
+    while (_running) {
+        std::this_thread::sleep_for(std::chrono::microseconds(_intervalMicros));
+
+        // A stop that lands between slices or while a hook rewrites PC is lost, so a request
+        // still pending is simply asked for again
+        _sampleRequested = true;
+        if (uc_engine* uc = sExecutor->GetUcInstance())
+            uc_emu_stop(uc);
+    }
+}
+
+void Profiler::Sample(uc_engine* uc, int threadId)
+{
+    uint32_t pc = 0, lr = 0, fp = 0;
+    int regs[3] = { UC_ARM_REG_PC, UC_ARM_REG_LR, UC_ARM_REG_R11 };
+    void* values[3] = { &pc, &lr, &fp };
+    uc_reg_read_batch(uc, regs, values, 3);
+
+    uint32_t frames[MAX_FRAMES];
+    int count = UnwindGuestStack(uc, pc, lr, fp, frames, MAX_FRAMES);
+
+    std::vector<uint32_t> key;
+    key.reserve(count + 1);
+    key.push_back(static_cast<uint32_t>(threadId));
+    key.insert(key.end(), frames, frames + count);
+
+    std::lock_guard<std::mutex> lock(_stacksMutex);
+    _stacks[key]++;
+    _sampleCount++;
+}
+
+void Profiler::WriteCollapsed(FILE* out) const
+{
+    std::lock_guard<std::mutex> lock(_stacksMutex);
+
+    // Many samples share frames; describe each address once
+    std::unordered_map<uint32_t, std::string> names;
+    auto describe = [&](uint32_t addr) -> const std::string& {
+        auto it = names.find(addr);
+        if (it == names.end())
+            it = names.emplace(addr, sSymbols->Describe(addr)).first;
+        return it->second;
+    };
+
+    for (const auto& [key, samples] : _stacks) {
+        fprintf(out, "thread_%u", key[0]);
+        // Collapsed stacks list the outermost frame first
+        for (size_t i = key.size() - 1; i >= 1; i--) {
+            std::string name = describe(key[i]);
+            // ';' separates frames and the last ' ' separates the count
+            for (char& c : name) {
+                if (c == ';' || c == ' ')
+                    c = '_';
+            }
+            fprintf(out, ";%s", name.c_str());
+        }
+        fprintf(out, " %llu\n", samples);
+    }
+}
+
+void Profiler::Flush() const
+{
+    if (_outputPath.empty())
+        return;
+
+    FILE* out = fopen(_outputPath.c_str(), "w");
+    if (!out) {
+        printf("Profiler: cannot write %s\n", _outputPath.c_str());
+        return;
+    }
+    WriteCollapsed(out);
+    fclose(out);
+    printf("Profiler: %llu samples written to %s\n", _sampleCount, _outputPath.c_str());
+}
@@ -0,0 +1,67 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "common.h"
+
+#include <unicorn/unicorn.h>
+
+#include <atomic>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Walks the AAPCS R11 frame chain ([fp - 4] = caller fp, [fp] = saved lr). Writes the current PC
+// followed by the call site of each return address, innermost first, with the Thumb bit cleared.
+// Returns the number of frames written.
+int UnwindGuestStack(uc_engine* uc, uint32_t pc, uint32_t lr, uint32_t fp, uint32_t* frames, int maxFrames);
+
+// Statistical profiler. A host thread asks the executor to stop the engine at a fixed interval;
+// the executor then records the PC and unwound stack of the guest thread that was running and
+// resumes it. Samples are symbolized when written, in collapsed-stack format
+// ("thread_1;outer;inner 42"), which flamegraph.pl and speedscope read directly.
+class Profiler
+{
+public:
+    static Profiler* GetInstance() { return !_instance ? _instance = new Profiler : _instance; }
+
+    // Collapsed stacks are written to `outputPath` by Flush
+    void Start(uint32_t intervalMicros, const std::string& outputPath);
+    void Stop();
+    bool IsRunning() const { return _running; }
+
+    // Executor side: true once per timer tick, after the engine was asked to stop for it
+    bool ConsumeSampleRequest() { return _sampleRequested.load(std::memory_order_relaxed) && _sampleRequested.exchange(false); }
+    void Sample(uc_engine* uc, int threadId);
+
+    void WriteCollapsed(FILE* out) const;
+    // Writes the profile to the output path given to Start; safe to call more than once
+    void Flush() const;
+
+private:
+    Profiler() {}
+    Profiler(Profiler const&) = delete;
+    void operator=(Profiler const&) = delete;
+    static Profiler* _instance;
+
+    void TimerProc();
+
+    static constexpr int MAX_FRAMES = 64;
+
+    std::thread _timerThread;
+    std::atomic<bool> _running = false;
+    std::atomic<bool> _sampleRequested = false;
+    uint32_t _intervalMicros = 1000;
+    std::string _outputPath;
+
+    // Key: guest thread id followed by the frames, innermost first
+    std::map<std::vector<uint32_t>, uint64_t> _stacks;
+    uint64_t _sampleCount = 0;
+    mutable std::mutex _stacksMutex;
+};
+
+#define sProfiler Profiler::GetInstance()
+
+#endif
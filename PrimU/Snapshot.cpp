@@ -0,0 +1,279 @@
+#include "Snapshot.h"
+#include "executor.h"
+#include "MemoryManager.h"
+#include "ThreadHandler.h"
+#include "PELoader.h"
+#include "LCD.h"
+
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <random>
+#include <vector>
+
+// Paths, modes and names only; anything longer means the file is corrupt
+static constexpr uint32_t MAX_SNAPSHOT_STRING = 0x10000;
+
+// The snapshot memory currently tracks dirty pages against; 0 = none
+static uint64_t g_baselineId = 0;
+static std::string g_baselinePath;
+
+static uint64_t NewSnapshotId()
+{
+    std::random_device device;
+    uint64_t id = (static_cast<uint64_t>(device()) << 32) ^ device()
+        ^ static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    return id ? id : 1;
+}
+
+void SnapshotWriter::WriteBytes(const void* data, size_t size)
+{
+    if (_ok && size && fwrite(data, 1, size, _file) != size)
+        _ok = false;
+}
+
+void SnapshotWriter::WriteString(const std::string& value)
+{
+    Write<uint32_t>(static_cast<uint32_t>(value.size()));
+    WriteBytes(value.data(), value.size());
+}
+
+void SnapshotWriter::WriteTime(GuestClock::time_point time)
+{
+    if (time == GuestClock::time_point::max())
+        Write<int64_t>(INT64_MAX);
+    else
+        Write<int64_t>((time - _now).count());
+}
+
+void SnapshotWriter::BeginSection(SnapshotSection section)
+{
+    Write<uint32_t>(section);
+    _sectionStart = _ftelli64(_file);
+    // Patched by EndSection
+    Write<uint64_t>(0);
+}
+
+void SnapshotWriter::EndSection()
+{
+    int64_t end = _ftelli64(_file);
+    uint64_t length = static_cast<uint64_t>(end - _sectionStart) - sizeof(uint64_t);
+    if (_fseeki64(_file, _sectionStart, SEEK_SET) != 0)
+        _ok = false;
+    Write<uint64_t>(length);
+    if (_fseeki64(_file, end, SEEK_SET) != 0)
+        _ok = false;
+    _sectionStart = -1;
+}
+
+void SnapshotReader::ReadBytes(void* data, size_t size)
+{
+    if (!size)
+        return;
+    if (!_ok || fread(data, 1, size, _file) != size) {
+        memset(data, 0, size);
+        Fail("file is truncated");
+    }
+}
+
+std::string SnapshotReader::ReadString()
+{
+    uint32_t size = Read<uint32_t>();
+    if (size > MAX_SNAPSHOT_STRING) {
+        Fail("string too long");
+        return std::string();
+    }
+    std::string value(size, '\0');
+    ReadBytes(value.data(), size);
+    return value;
+}
+
+GuestClock::time_point SnapshotReader::ReadTime()
+{
+    int64_t offset = Read<int64_t>();
+    if (offset == INT64_MAX)
+        return GuestClock::time_point::max();
+    return _now + GuestClock::duration(offset);
+}
+
+void SnapshotReader::Skip(size_t size)
+{
+    if (_ok && _fseeki64(_file, static_cast<int64_t>(size), SEEK_CUR) != 0)
+        Fail("file is truncated");
+}
+
+bool SnapshotReader::BeginSection(SnapshotSection section)
+{
+    uint32_t tag = Read<uint32_t>();
+    uint64_t length = Read<uint64_t>();
+    if (!_ok)
+        return false;
+    if (tag != section) {
+        Fail("unexpected section");
+        return false;
+    }
+    _sectionEnd = _ftelli64(_file) + static_cast<int64_t>(length);
+    return true;
+}
+
+bool SnapshotReader::EndSection()
+{
+    if (_ok && _ftelli64(_file) != _sectionEnd)
+        Fail("section size mismatch");
+    _sectionEnd = -1;
+    return _ok;
+}
+
+void SnapshotReader::Fail(const char* reason)
+{
+    if (_ok)
+        printf("Snapshot: %s\n", reason);
+    _ok = false;
+}
+
+bool SaveSnapshot(const std::string& path)
+{
+    FILE* file = fopen(path.c_str(), "wb");
+    if (!file) {
+        printf("Snapshot: cannot write %s\n", path.c_str());
+        return false;
+    }
+    // Guest memory is written in page runs; a large buffer keeps that to few host writes
+    std::vector<char> buffer(1 << 20);
+    setvbuf(file, buffer.data(), _IOFBF, buffer.size());
+
+    // Overwriting the baseline itself cannot be relative to it
+    bool incremental = g_baselineId && path != g_baselinePath;
+    uint64_t id = NewSnapshotId();
+
+    SnapshotWriter writer(file, GuestClock::now());
+    writer.Write<uint32_t>(SNAPSHOT_MAGIC);
+    writer.Write<uint32_t>(SNAPSHOT_VERSION);
+    writer.Write<uint64_t>(id);
+    writer.Write<uint64_t>(incremental ? g_baselineId : 0);
+    writer.WriteString(incremental ? g_baselinePath : std::string());
+
+    writer.BeginSection(SNAPSHOT_SECTION_MEMORY);
+    sMemoryManager->SaveSnapshot(writer, incremental);
+    writer.EndSection();
+
+    writer.BeginSection(SNAPSHOT_SECTION_MODULES);
+    SavePEImageSnapshot(writer);
+    writer.EndSection();
+
+    writer.BeginSection(SNAPSHOT_SECTION_SYSTEM);
+    SaveSystemSnapshot(writer);
+    writer.EndSection();
+
+    writer.BeginSection(SNAPSHOT_SECTION_THREADS);
+    sThreadHandler->SaveSnapshot(writer);
+    writer.EndSection();
+
+    writer.BeginSection(SNAPSHOT_SECTION_LCD);
+    LCDHandler::SaveSnapshot(writer);
+    writer.EndSection();
+
+    bool ok = writer.Ok();
+    if (fclose(file) != 0)
+        ok = false;
+
+    if (!ok) {
+        printf("Snapshot: writing %s failed\n", path.c_str());
+        return false;
+    }
+
+    if (!incremental) {
+        sMemoryManager->MarkBaseline();
+        g_baselineId = id;
+        g_baselinePath = path;
+    }
+    printf("Snapshot: saved to %s%s\n", path.c_str(), incremental ? " (incremental)" : "");
+    return true;
+}
+
+bool RestoreSnapshot(const std::string& path)
+{
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) {
+        printf("Snapshot: cannot read %s\n", path.c_str());
+        return false;
+    }
+    std::vector<char> buffer(1 << 20);
+    setvbuf(file, buffer.data(), _IOFBF, buffer.size());
+
+    SnapshotReader reader(file, GuestClock::now());
+    if (reader.Read<uint32_t>() != SNAPSHOT_MAGIC)
+        reader.Fail("not a snapshot file");
+    else if (reader.Read<uint32_t>() != SNAPSHOT_VERSION)
+        reader.Fail("unsupported snapshot version");
+    uint64_t id = reader.Read<uint64_t>();
+    uint64_t baseId = reader.Read<uint64_t>();
+    std::string basePath = reader.ReadString();
+    if (!reader.Ok()) {
+        fclose(file);
+        return false;
+    }
+
+    // Running threads are replaced; their stacks live in guest memory, which is restored below
+    sThreadHandler->ClearThreads();
+
+    // Only pages written since the baseline need to be undone when this is the baseline or builds on it
+    bool reverted = g_baselineId && (id == g_baselineId || baseId == g_baselineId) && sMemoryManager->RevertToBaseline();
+    if (baseId && !reverted) {
+        // The base comes in first and becomes the baseline
+        if (!RestoreSnapshot(basePath) || g_baselineId != baseId) {
+            printf("Snapshot: base snapshot %s does not match %s\n", basePath.c_str(), path.c_str());
+            fclose(file);
+            return false;
+        }
+        reverted = true;
+    }
+    if (!reverted) {
+        sMemoryManager->DropBaseline();
+        g_baselineId = 0;
+    }
+
+    // Sections are restored in the order they depend on each other: modules refer to memory
+    // blocks, threads to events and critical sections, and waiter queues back to threads.
+    // A failure part way leaves the machine inconsistent, so the caller must not run it.
+    if (reader.BeginSection(SNAPSHOT_SECTION_MEMORY)) {
+        sMemoryManager->RestoreSnapshot(reader, reverted && id == g_baselineId);
+        reader.EndSection();
+    }
+    if (reader.BeginSection(SNAPSHOT_SECTION_MODULES)) {
+        RestorePEImageSnapshot(reader);
+        reader.EndSection();
+    }
+    if (reader.BeginSection(SNAPSHOT_SECTION_SYSTEM)) {
+        RestoreSystemSnapshot(reader);
+        reader.EndSection();
+    }
+    if (reader.BeginSection(SNAPSHOT_SECTION_THREADS)) {
+        sThreadHandler->RestoreSnapshot(reader);
+        if (reader.EndSection())
+            LinkSystemSnapshot();
+    }
+    if (reader.BeginSection(SNAPSHOT_SECTION_LCD)) {
+        LCDHandler::RestoreSnapshot(reader);
+        reader.EndSection();
+    }
+
+    fclose(file);
+    if (!reader.Ok()) {
+        printf("Snapshot: restoring %s failed\n", path.c_str());
+        sMemoryManager->DropBaseline();
+        g_baselineId = 0;
+        return false;
+    }
+
+    if (!reverted) {
+        sMemoryManager->MarkBaseline();
+        g_baselineId = id;
+        g_baselinePath = path;
+    }
+
+    // Guest code may now differ from what the cache decoded
+    sExecutor->FlushCodeCaches();
+    printf("Snapshot: restored from %s%s\n", path.c_str(), reverted ? " (changed pages only)" : "");
+    return true;
+}
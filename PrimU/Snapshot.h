@@ -0,0 +1,117 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "common.h"
+#include "GuestClock.h"
+
+#include <cstdio>
+#include <string>
+#include <type_traits>
+
+// Machine snapshots: guest memory, heap metadata, threads and the HLE object tables, so a booted
+// system can be saved once and restored in place of the boot.
+//
+// File layout: "PUSN" magic, format version, snapshot id, base id and base path, then tagged
+// sections in a fixed order. Each section records its length, so a reader can tell a truncated or
+// mismatched file from a valid one. Bump SNAPSHOT_VERSION whenever a section's contents change;
+// older files are then rejected.
+//
+// Incremental snapshots: a full save or restore makes that snapshot the baseline and starts dirty
+// page tracking. Later saves to another path only store the pages written since, and name the
+// baseline as their base. Restoring the baseline, or a snapshot built on it, first reverts the
+// written pages and then copies only what differs; anything else is a full restore that becomes
+// the new baseline.
+constexpr uint32_t SNAPSHOT_MAGIC = 0x4E535550; // "PUSN"
+constexpr uint32_t SNAPSHOT_VERSION = 4;
+
+enum SnapshotSection : uint32_t
+{
+    SNAPSHOT_SECTION_MEMORY  = 0x4D454D4F, // "MEMO"
+    SNAPSHOT_SECTION_SYSTEM  = 0x53595354, // "SYST"
+    SNAPSHOT_SECTION_THREADS = 0x54485244, // "THRD"
+    SNAPSHOT_SECTION_LCD     = 0x4C434420, // "LCD "
+    SNAPSHOT_SECTION_MODULES = 0x4D4F4453, // "MODS"
+};
+
+class SnapshotWriter
+{
+public:
+    // Guest time points are stored relative to `now`, as guest time restarts with every run
+    SnapshotWriter(FILE* file, GuestClock::time_point now) : _file(file), _now(now) { }
+
+    void WriteBytes(const void* data, size_t size);
+    template <typename T>
+    void Write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "only plain values can be written directly");
+        WriteBytes(&value, sizeof(T));
+    }
+    void WriteString(const std::string& value);
+    void WriteTime(GuestClock::time_point time);
+
+    void BeginSection(SnapshotSection section);
+    void EndSection();
+
+    bool Ok() const { return _ok; }
+
+private:
+    FILE* _file;
+    GuestClock::time_point _now;
+    int64_t _sectionStart = -1;
+    bool _ok = true;
+};
+
+class SnapshotReader
+{
+public:
+    SnapshotReader(FILE* file, GuestClock::time_point now) : _file(file), _now(now) { }
+
+    void ReadBytes(void* data, size_t size);
+    template <typename T>
+    T Read()
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "only plain values can be read directly");
+        T value{};
+        ReadBytes(&value, sizeof(T));
+        return value;
+    }
+    std::string ReadString();
+    GuestClock::time_point ReadTime();
+    void Skip(size_t size);
+
+    // False if the next section is not `section`
+    bool BeginSection(SnapshotSection section);
+    // False if the section was not consumed exactly
+    bool EndSection();
+
+    bool Ok() const { return _ok; }
+    // Marks the snapshot as unusable, e.g. when its contents do not fit the running configuration
+    void Fail(const char* reason);
+
+private:
+    FILE* _file;
+    GuestClock::time_point _now;
+    int64_t _sectionEnd = -1;
+    bool _ok = true;
+};
+
+// Both must be called on the emulator thread between slices (Executor::RequestSnapshot and
+// RequestRestore), or after Executor::Initialize and before Execute. A failed restore leaves the
+// machine inconsistent; it must not be run.
+bool SaveSnapshot(const std::string& path);
+bool RestoreSnapshot(const std::string& path);
+
+// Implemented in system.cpp: file, device, critical section and event tables. Restoring takes two
+// steps because the tables and the threads refer to each other; LinkSystemSnapshot runs once the
+// threads exist.
+struct Event;
+struct CriticalSection;
+void SaveSystemSnapshot(SnapshotWriter& writer);
+void RestoreSystemSnapshot(SnapshotReader& reader);
+void LinkSystemSnapshot();
+uint32_t GetSnapshotEventId(const Event* ev);
+Event* FindSnapshotEvent(uint32_t id);
+uint32_t GetSnapshotCriticalSectionKey(const CriticalSection* cs);
+CriticalSection* FindSnapshotCriticalSection(uint32_t key);
+
+#endif
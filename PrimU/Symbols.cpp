@@ -0,0 +1,129 @@
+#include "Symbols.h"
+#include "PELoader.h"
+
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+SymbolTable* SymbolTable::_instance = nullptr;
+
+static bool ParseHexAddress(const std::string& token, uint32_t* out)
+{
+    size_t start = (token.size() > 2 && token[0] == '0' && (token[1] == 'x' || token[1] == 'X')) ? 2 : 0;
+    // Bare hex needs the full 8 digits, so short names such as "add" are not taken for addresses
+    if (start == 0 && token.size() != 8)
+        return false;
+    if (token.size() == start || token.size() - start > 8)
+        return false;
+    for (size_t i = start; i < token.size(); i++) {
+        if (!isxdigit(static_cast<unsigned char>(token[i])))
+            return false;
+    }
+    *out = static_cast<uint32_t>(strtoul(token.c_str() + start, nullptr, 16));
+    return true;
+}
+
+bool SymbolTable::LoadMapFile(const std::string& path)
+{
+    std::ifstream in(path);
+    if (!in.is_open())
+        return false;
+
+    std::string line;
+    while (std::getline(in, line)) {
+        std::vector<std::string> tokens;
+        std::string token;
+        for (char c : line) {
+            if (isspace(static_cast<unsigned char>(c)) || c == ',') {
+                if (!token.empty())
+                    tokens.push_back(token);
+                token.clear();
+            }
+            else if (c != '"')
+                token += c;
+        }
+        if (!token.empty())
+            tokens.push_back(token);
+        if (tokens.size() < 2)
+            continue;
+
+        uint32_t addr;
+        if (ParseHexAddress(tokens[0], &addr))
+            _userSymbols[addr & ~1u] = Symbol{ 0, tokens[1] };
+        else if (ParseHexAddress(tokens[1], &addr))
+            _userSymbols[addr & ~1u] = Symbol{ 0, tokens[0] };
+    }
+    return true;
+}
+
+void SymbolTable::AddImageSymbol(uint32_t addr, uint32_t size, const std::string& name)
+{
+    if (addr == 0 || name.empty())
+        return;
+    _imageSymbols.emplace(addr & ~1u, Symbol{ size, name });
+}
+
+bool SymbolTable::Find(const std::map<uint32_t, Symbol>& symbols, uint32_t addr, std::string* out)
+{
+    auto it = symbols.upper_bound(addr);
+    if (it == symbols.begin())
+        return false;
+    --it;
+
+    uint32_t offset = addr - it->first;
+    uint32_t span = it->second.size ? it->second.size : UNSIZED_SYMBOL_SPAN;
+    if (offset >= span)
+        return false;
+
+    *out = it->second.name;
+    if (offset) {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "+0x%X", offset);
+        *out += buf;
+    }
+    return true;
+}
+
+bool SymbolTable::FindExport(uint32_t addr, std::string* out)
+{
+    for (const auto& img : GetLoadedPEImages()) {
+        if (addr < img->actualImageBase || addr - img->actualImageBase >= img->sizeOfImage)
+            continue;
+
+        // Exports carry no size; take the nearest one below the address
+        const std::string* best = nullptr;
+        uint32_t bestVA = 0;
+        for (const auto& [name, va] : img->exportsByName) {
+            uint32_t start = va & ~1u;
+            if (start <= addr && (!best || start > bestVA)) {
+                best = &name;
+                bestVA = start;
+            }
+        }
+
+        std::string module = img->path.substr(img->path.find_last_of("\\/") + 1);
+        char buf[16];
+        if (best) {
+            snprintf(buf, sizeof(buf), "+0x%X", addr - bestVA);
+            *out = module + "!" + *best + (addr != bestVA ? buf : "");
+        }
+        else {
+            snprintf(buf, sizeof(buf), "+0x%X", addr - img->actualImageBase);
+            *out = module + buf;
+        }
+        return true;
+    }
+    return false;
+}
+
+std::string SymbolTable::Describe(uint32_t addr) const
+{
+    std::string name;
+    if (Find(_userSymbols, addr, &name) || Find(_imageSymbols, addr, &name) || FindExport(addr, &name))
+        return name;
+
+    char buf[16];
+    snprintf(buf, sizeof(buf), "0x%08X", addr);
+    return buf;
+}
@@ -0,0 +1,50 @@
+#ifndef SYMBOLS_H
+#define SYMBOLS_H
+
+#include "common.h"
+
+#include <map>
+#include <string>
+
+// Guest address -> function name, for profiles and diagnostics. Sources, most specific first:
+// a user-supplied map file (e.g. exported from Ghidra), the ELF symbol table of the firmware,
+// and the exports of loaded PE modules.
+class SymbolTable
+{
+public:
+    static SymbolTable* GetInstance() { return !_instance ? _instance = new SymbolTable : _instance; }
+
+    // One symbol per line: a hex address and a name in either order, separated by whitespace
+    // or commas. Lines without both are skipped. Returns false if the file cannot be opened.
+    bool LoadMapFile(const std::string& path);
+    // Thumb bit is ignored; size 0 means the symbol extends to the next one (up to UNSIZED_SYMBOL_SPAN)
+    void AddImageSymbol(uint32_t addr, uint32_t size, const std::string& name);
+
+    // "name", "name+0x1c", "module!export+0x40", or "0x%08X" when nothing covers the address
+    std::string Describe(uint32_t addr) const;
+
+private:
+    SymbolTable() {}
+    SymbolTable(SymbolTable const&) = delete;
+    void operator=(SymbolTable const&) = delete;
+    static SymbolTable* _instance;
+
+    // Unsized symbols (map files) cover at most this much, so code outside the mapped range falls through
+    static constexpr uint32_t UNSIZED_SYMBOL_SPAN = 0x10000;
+
+    struct Symbol
+    {
+        uint32_t size;
+        std::string name;
+    };
+
+    static bool Find(const std::map<uint32_t, Symbol>& symbols, uint32_t addr, std::string* out);
+    static bool FindExport(uint32_t addr, std::string* out);
+
+    std::map<uint32_t, Symbol> _userSymbols;
+    std::map<uint32_t, Symbol> _imageSymbols;
+};
+
+#define sSymbols SymbolTable::GetInstance()
+
+#endif
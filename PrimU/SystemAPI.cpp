@@ -2,774 +2,851 @@
 #include "ThreadHandler.h"
 
 #include "handlers.h"
+#include "SystemCallBinding.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
 
 SystemAPI* SystemAPI::_instance = nullptr;
 
-#define REGISTER_HANDLER(id, s, n, h) RegisterHandler(new InterruptHandler(id, s, h, n))
+#define REGISTER_HANDLER(id, s, n, h) InterruptHandler(id, s, h, n)
 
-SystemAPI::SystemAPI()
+// SDKLIB services form a dense ID range, so dispatch is a single index into this table
+static constexpr InterruptHandler s_sdklibHandlers[] =
+{
+	REGISTER_HANDLER(SDKLIB_OSCreateThread, HANDLE_IMPLEMENTED, "OSCreateThread", OSCreateThread),
+	REGISTER_HANDLER(SDKLIB_OSTerminateThread, HANDLE_NAMEONLY, "OSTerminateThread", nullptr),
+	REGISTER_HANDLER(SDKLIB_OSSetThreadPriority, HANDLE_IMPLEMENTED, "OSSetThreadPriority", Bind<&OSSetThreadPriority>),
+	REGISTER_HANDLER(SDKLIB_OSGetThreadPriority, HANDLE_NAMEONLY, "OSGetThreadPriority", nullptr),
+	REGISTER_HANDLER(SDKLIB_OSSuspendThread, HANDLE_NAMEONLY, "OSSuspendThread", OSSuspendThread),
+	REGISTER_HANDLER(SDKLIB_OSResumeThread, HANDLE_NAMEONLY, "OSResumeThread", OSResumeThread),
+	REGISTER_HANDLER(SDKLIB_OSWakeUpThread, HANDLE_NAMEONLY, "OSWakeUpThread", nullptr),
+	REGISTER_HANDLER(SDKLIB_OSExitThread, HANDLE_NAMEONLY, "OSExitThread", nullptr),
+	REGISTER_HANDLER(SDKLIB_OSSleep, HANDLE_IMPLEMENTED, "OSSleep", Bind<&OSSleep>),
+	REGISTER_HANDLER(SDKLIB_OSCreateSemaphore, HANDLE_NAMEONLY, "OSCreateSemaphore", nullptr),
+	REGISTER_HANDLER(SDKLIB_OSWaitForSemaphore, HANDLE_NAMEONLY, "OSWaitForSemaphore", nullptr),
+	REGISTER_HANDLER(SDKLIB_OSReleaseSemaphore, HANDLE_NAMEONLY, "OSReleaseSemaphore", nullptr),
+	REGISTER_HANDLER(SDKLIB_OSCloseSemaphore, HANDLE_NAMEONLY, "OSCloseSemaphore", nullptr),
+	REGISTER_HANDLER(SDKLIB_OSCreateEvent, HANDLE_IMPLEMENTED, "OSCreateEvent", Bind<&OSCreateEvent>),
+	REGISTER_HANDLER(SDKLIB_OSWaitForEvent, HANDLE_NAMEONLY, "OSWaitForEvent", Bind<&OSWaitForEvent>),
+	REGISTER_HANDLER(SDKLIB_OSSetEvent, HANDLE_IMPLEMENTED, "OSSetEvent", Bind<&OSSetEvent>),
+	REGISTER_HANDLER(SDKLIB_OSResetEvent, HANDLE_NAMEONLY, "OSResetEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_OSCloseEvent, HANDLE_NAMEONLY, "OSCloseEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_OSInitCriticalSection, HANDLE_IMPLEMENTED, "OSInitCriticalSection", Bind<&OSInitCriticalSection>),
+	REGISTER_HANDLER(SDKLIB_OSEnterCriticalSection, HANDLE_IMPLEMENTED, "OSEnterCriticalSection", Bind<&OSEnterCriticalSection>),
+	REGISTER_HANDLER(SDKLIB_OSLeaveCriticalSection, HANDLE_IMPLEMENTED, "OSLeaveCriticalSection", Bind<&OSLeaveCriticalSection>),
+	REGISTER_HANDLER(SDKLIB_OSDeleteCriticalSection, HANDLE_NAMEONLY, "OSDeleteCriticalSection", nullptr),
+	REGISTER_HANDLER(SDKLIB_OSSetLastError, HANDLE_NAMEONLY, "OSSetLastError", nullptr),
+	REGISTER_HANDLER(SDKLIB_OSGetLastError, HANDLE_NAMEONLY, "OSGetLastError", nullptr),
+	REGISTER_HANDLER(SDKLIB_OSCreateMsgQue, HANDLE_NAMEONLY, "OSCreateMsgQue", nullptr),
+	REGISTER_HANDLER(SDKLIB_OSPostMsgQue, HANDLE_NAMEONLY, "OSPostMsgQue", nullptr),
+	REGISTER_HANDLER(SDKLIB_OSSendMsgQue, HANDLE_NAMEONLY, "OSSendMsgQue", nullptr),
+	REGISTER_HANDLER(SDKLIB_OSPeekMsgQue, HANDLE_NAMEONLY, "OSPeekMsgQue", nullptr),
+	REGISTER_HANDLER(SDKLIB_OSGetMsgQue, HANDLE_NAMEONLY, "OSGetMsgQue", nullptr),
+	REGISTER_HANDLER(SDKLIB_OSCloseMsgQue, HANDLE_NAMEONLY, "OSCloseMsgQue", nullptr),
+	REGISTER_HANDLER(SDKLIB_InterruptInitialize, HANDLE_NAMEONLY, "InterruptInitialize", InterruptInitialize),
+	REGISTER_HANDLER(SDKLIB_InterruptEnable, HANDLE_NAMEONLY, "InterruptEnable", nullptr),
+	REGISTER_HANDLER(SDKLIB_InterruptDisable, HANDLE_NAMEONLY, "InterruptDisable", nullptr),
+	REGISTER_HANDLER(SDKLIB_InterruptDone, HANDLE_NAMEONLY, "InterruptDone", InterruptDone),
+	REGISTER_HANDLER(SDKLIB_InterruptSetMode, HANDLE_NAMEONLY, "InterruptSetMode", nullptr),
+	REGISTER_HANDLER(SDKLIB_DisableAutoSync, HANDLE_NAMEONLY, "DisableAutoSync", nullptr),
+	REGISTER_HANDLER(SDKLIB_EnableAutoSync, HANDLE_NAMEONLY, "EnableAutoSync", nullptr),
+	REGISTER_HANDLER(SDKLIB_getvect, HANDLE_NAMEONLY, "getvect", nullptr),
+	REGISTER_HANDLER(SDKLIB_setvect, HANDLE_NAMEONLY, "setvect", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetLCDContrast, HANDLE_NAMEONLY, "GetLCDContrast", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetLCDContrast, HANDLE_NAMEONLY, "SetLCDContrast", nullptr),
+	REGISTER_HANDLER(SDKLIB_LCDOn, HANDLE_IMPLEMENTED, "LCDOn", LCDOn),
+	REGISTER_HANDLER(SDKLIB_LCDOff, HANDLE_NAMEONLY, "LCDOff", nullptr),
+	REGISTER_HANDLER(SDKLIB_CheckLCDOn, HANDLE_NAMEONLY, "CheckLCDOn", nullptr),
+	REGISTER_HANDLER(SDKLIB_Buzzer, HANDLE_NAMEONLY, "Buzzer", nullptr),
+	REGISTER_HANDLER(SDKLIB_KeyBeep, HANDLE_NAMEONLY, "KeyBeep", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetTimer1IntHandler, HANDLE_NAMEONLY, "SetTimer1IntHandler", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetAutoPowerOff, HANDLE_NAMEONLY, "SetAutoPowerOff", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetTimer1IntHandler, HANDLE_NAMEONLY, "GetTimer1IntHandler", nullptr),
+	REGISTER_HANDLER(SDKLIB_RemapMemory, HANDLE_NAMEONLY, "RemapMemory", nullptr),
+	REGISTER_HANDLER(SDKLIB_SysPowerOff, HANDLE_NAMEONLY, "SysPowerOff", SysPowerOff),
+	REGISTER_HANDLER(SDKLIB_SetSysKeyState, HANDLE_NAMEONLY, "SetSysKeyState", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetSysKeyState, HANDLE_NAMEONLY, "GetSysKeyState", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetBatteryType, HANDLE_NAMEONLY, "GetBatteryType", nullptr),
+	REGISTER_HANDLER(SDKLIB_BatteryLowCheck, HANDLE_NAMEONLY, "BatteryLowCheck", BatteryLowCheck),
+	REGISTER_HANDLER(SDKLIB_lmalloc, HANDLE_IMPLEMENTED, "lmalloc", Bind<&lmalloc>),
+	REGISTER_HANDLER(SDKLIB_lcalloc, HANDLE_IMPLEMENTED, "lcalloc", Bind<&lcalloc>),
+	REGISTER_HANDLER(SDKLIB_lrealloc, HANDLE_IMPLEMENTED, "lrealloc", Bind<&lrealloc>),
+	REGISTER_HANDLER(SDKLIB__lfree, HANDLE_IMPLEMENTED, "_lfree", Bind<&_lfree>),
+	REGISTER_HANDLER(SDKLIB_GetPenEvent, HANDLE_NAMEONLY, "GetPenEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_CheckPenEvent, HANDLE_NAMEONLY, "CheckPenEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_ClearPenEvent, HANDLE_NAMEONLY, "ClearPenEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_PutSystemEvent, HANDLE_NAMEONLY, "PutSystemEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetEvent, HANDLE_NAMEONLY, "GetEvent", Bind<&GetEvent>),
+	REGISTER_HANDLER(SDKLIB_GetPendEvent, HANDLE_NAMEONLY, "GetPendEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetEventType, HANDLE_NAMEONLY, "SetEventType", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetEventType, HANDLE_NAMEONLY, "GetEventType", nullptr),
+	REGISTER_HANDLER(SDKLIB_PutEvent, HANDLE_NAMEONLY, "PutEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_PutEventExt, HANDLE_NAMEONLY, "PutEventExt", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetLastEvent, HANDLE_NAMEONLY, "GetLastEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_TestPendEvent, HANDLE_NAMEONLY, "TestPendEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_ClearPendEvent, HANDLE_NAMEONLY, "ClearPendEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_ClearPenState, HANDLE_NAMEONLY, "ClearPenState", nullptr),
+	REGISTER_HANDLER(SDKLIB_ClearEvent, HANDLE_NAMEONLY, "ClearEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_ClearAllEvents, HANDLE_NAMEONLY, "ClearAllEvents", nullptr),
+	REGISTER_HANDLER(SDKLIB_TestKeyEvent, HANDLE_NAMEONLY, "TestKeyEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetSystemVariable, HANDLE_NAMEONLY, "SetSystemVariable", Bind<&SetSystemVariable>),
+	REGISTER_HANDLER(SDKLIB_GetCharWidth, HANDLE_NAMEONLY, "GetCharWidth", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetFontHeight, HANDLE_NAMEONLY, "GetFontHeight", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetFontType, HANDLE_NAMEONLY, "GetFontType", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetStringLength, HANDLE_NAMEONLY, "GetStringLength", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetFontType, HANDLE_NAMEONLY, "SetFontType", nullptr),
+	REGISTER_HANDLER(SDKLIB_WriteAlignString, HANDLE_NAMEONLY, "WriteAlignString", nullptr),
+	REGISTER_HANDLER(SDKLIB_WriteChar, HANDLE_NAMEONLY, "WriteChar", nullptr),
+	REGISTER_HANDLER(SDKLIB_WriteString, HANDLE_NAMEONLY, "WriteString", nullptr),
+	REGISTER_HANDLER(SDKLIB_WriteStringInWindow, HANDLE_NAMEONLY, "WriteStringInWindow", nullptr),
+	REGISTER_HANDLER(SDKLIB_WriteStringInWindowEx, HANDLE_NAMEONLY, "WriteStringInWindowEx", nullptr),
+	REGISTER_HANDLER(SDKLIB_Printf, HANDLE_NAMEONLY, "Printf", nullptr),
+	REGISTER_HANDLER(SDKLIB_PrintfXY, HANDLE_NAMEONLY, "PrintfXY", nullptr),
+	REGISTER_HANDLER(SDKLIB_ShowGraphic, HANDLE_NAMEONLY, "ShowGraphic", nullptr),
+	REGISTER_HANDLER(SDKLIB_SizeofGraphic, HANDLE_NAMEONLY, "SizeofGraphic", nullptr),
+	REGISTER_HANDLER(SDKLIB_InitGraphic, HANDLE_NAMEONLY, "InitGraphic", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateIcon, HANDLE_NAMEONLY, "CreateIcon", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetCursorSize, HANDLE_NAMEONLY, "SetCursorSize", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetCursorSize, HANDLE_NAMEONLY, "GetCursorSize", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetCursorPosition, HANDLE_NAMEONLY, "SetCursorPosition", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetCursorPosition, HANDLE_NAMEONLY, "GetCursorPosition", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetCursorType, HANDLE_NAMEONLY, "SetCursorType", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetCursorType, HANDLE_NAMEONLY, "GetCursorType", nullptr),
+	REGISTER_HANDLER(SDKLIB_CursorLock, HANDLE_NAMEONLY, "CursorLock", nullptr),
+	REGISTER_HANDLER(SDKLIB_CursorUnlock, HANDLE_NAMEONLY, "CursorUnlock", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetTransparentColor, HANDLE_NAMEONLY, "SetTransparentColor", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetTransparentColor, HANDLE_NAMEONLY, "GetTransparentColor", nullptr),
+	REGISTER_HANDLER(SDKLIB_rgbSetBkColor, HANDLE_NAMEONLY, "rgbSetBkColor", nullptr),
+	REGISTER_HANDLER(SDKLIB_rgbSetColor, HANDLE_NAMEONLY, "rgbSetColor", nullptr),
+	REGISTER_HANDLER(SDKLIB_rgbGetBkColor, HANDLE_NAMEONLY, "rgbGetBkColor", nullptr),
+	REGISTER_HANDLER(SDKLIB_rgbGetColor, HANDLE_NAMEONLY, "rgbGetColor", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetPenStyle, HANDLE_NAMEONLY, "SetPenStyle", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetPenStyle, HANDLE_NAMEONLY, "GetPenStyle", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetPenSize, HANDLE_NAMEONLY, "GetPenSize", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetPenSize, HANDLE_NAMEONLY, "SetPenSize", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetPixel, HANDLE_NAMEONLY, "GetPixel", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetPixel, HANDLE_NAMEONLY, "SetPixel", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetImage, HANDLE_NAMEONLY, "GetImage", nullptr),
+	REGISTER_HANDLER(SDKLIB_PutImage, HANDLE_NAMEONLY, "PutImage", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetDrawArea, HANDLE_NAMEONLY, "SetDrawArea", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetDrawArea, HANDLE_NAMEONLY, "GetDrawArea", nullptr),
+	REGISTER_HANDLER(SDKLIB_DrawLine, HANDLE_NAMEONLY, "DrawLine", nullptr),
+	REGISTER_HANDLER(SDKLIB_DrawRect, HANDLE_NAMEONLY, "DrawRect", nullptr),
+	REGISTER_HANDLER(SDKLIB_FillRect, HANDLE_NAMEONLY, "FillRect", nullptr),
+	REGISTER_HANDLER(SDKLIB_DrawRoundRect, HANDLE_NAMEONLY, "DrawRoundRect", nullptr),
+	REGISTER_HANDLER(SDKLIB_DrawCircle, HANDLE_NAMEONLY, "DrawCircle", nullptr),
+	REGISTER_HANDLER(SDKLIB_FillCircle, HANDLE_NAMEONLY, "FillCircle", nullptr),
+	REGISTER_HANDLER(SDKLIB_DrawEllipse, HANDLE_NAMEONLY, "DrawEllipse", nullptr),
+	REGISTER_HANDLER(SDKLIB_FillEllipse, HANDLE_NAMEONLY, "FillEllipse", nullptr),
+	REGISTER_HANDLER(SDKLIB_InverseSetArea, HANDLE_NAMEONLY, "InverseSetArea", nullptr),
+	REGISTER_HANDLER(SDKLIB_ClearScreen, HANDLE_NAMEONLY, "ClearScreen", nullptr),
+	REGISTER_HANDLER(SDKLIB_ClearSetArea, HANDLE_NAMEONLY, "ClearSetArea", nullptr),
+	REGISTER_HANDLER(SDKLIB_ScrollDown, HANDLE_NAMEONLY, "ScrollDown", nullptr),
+	REGISTER_HANDLER(SDKLIB_ScrollLeft, HANDLE_NAMEONLY, "ScrollLeft", nullptr),
+	REGISTER_HANDLER(SDKLIB_ScrollRight, HANDLE_NAMEONLY, "ScrollRight", nullptr),
+	REGISTER_HANDLER(SDKLIB_ScrollUp, HANDLE_NAMEONLY, "ScrollUp", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetRealLCD, HANDLE_NAMEONLY, "GetRealLCD", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetToRealLCD, HANDLE_NAMEONLY, "SetToRealLCD", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetToVirtualLCD, HANDLE_NAMEONLY, "SetToVirtualLCD", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateVirtualLCD, HANDLE_NAMEONLY, "CreateVirtualLCD", nullptr),
+	REGISTER_HANDLER(SDKLIB_DeleteVirtualLCD, HANDLE_NAMEONLY, "DeleteVirtualLCD", nullptr),
+	REGISTER_HANDLER(SDKLIB__BitBlt, HANDLE_NAMEONLY, "_BitBlt", nullptr),
+	REGISTER_HANDLER(SDKLIB___fillrect, HANDLE_NAMEONLY, "__fillrect", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetActiveLCD, HANDLE_NAMEONLY, "SetActiveLCD", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetRealLCD, HANDLE_NAMEONLY, "SetRealLCD", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetActiveLCD, HANDLE_IMPLEMENTED, "GetActiveLCD", GetActiveLCD),
+	REGISTER_HANDLER(SDKLIB_CreateCompatibleLCD, HANDLE_NAMEONLY, "CreateCompatibleLCD", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateCompatibleImage, HANDLE_NAMEONLY, "CreateCompatibleImage", nullptr),
+	REGISTER_HANDLER(SDKLIB_DeleteLCD, HANDLE_NAMEONLY, "DeleteLCD", nullptr),
+	REGISTER_HANDLER(SDKLIB_SelectLCDObject, HANDLE_NAMEONLY, "SelectLCDObject", nullptr),
+	REGISTER_HANDLER(SDKLIB_DeleteLCDObject, HANDLE_NAMEONLY, "DeleteLCDObject", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetDCObject, HANDLE_NAMEONLY, "SetDCObject", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetWindowSize, HANDLE_NAMEONLY, "GetWindowSize", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetImageSize, HANDLE_NAMEONLY, "GetImageSize", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetImageSizeExt, HANDLE_NAMEONLY, "GetImageSizeExt", nullptr),
+	REGISTER_HANDLER(SDKLIB_ImageData, HANDLE_NAMEONLY, "ImageData", nullptr),
+	REGISTER_HANDLER(SDKLIB_SizeofImage, HANDLE_NAMEONLY, "SizeofImage", nullptr),
+	REGISTER_HANDLER(SDKLIB_FreeImage, HANDLE_NAMEONLY, "FreeImage", nullptr),
+	REGISTER_HANDLER(SDKLIB_Delay, HANDLE_IMPLEMENTED, "Delay", Bind<&Delay>),
+	REGISTER_HANDLER(SDKLIB_PenDelay, HANDLE_IMPLEMENTED, "PenDelay", Bind<&PenDelay>),
+	REGISTER_HANDLER(SDKLIB_GetPenSilenceArea, HANDLE_NAMEONLY, "GetPenSilenceArea", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetPenSilenceArea, HANDLE_NAMEONLY, "SetPenSilenceArea", nullptr),
+	REGISTER_HANDLER(SDKLIB_WarningBeep, HANDLE_NAMEONLY, "WarningBeep", nullptr),
+	REGISTER_HANDLER(SDKLIB_LockSystem, HANDLE_NAMEONLY, "LockSystem", nullptr),
+	REGISTER_HANDLER(SDKLIB_UnlockSystem, HANDLE_NAMEONLY, "UnlockSystem", nullptr),
+	REGISTER_HANDLER(SDKLIB_CopyToClipBoard, HANDLE_NAMEONLY, "CopyToClipBoard", nullptr),
+	REGISTER_HANDLER(SDKLIB_CopyFromClipBoard, HANDLE_NAMEONLY, "CopyFromClipBoard", nullptr),
+	REGISTER_HANDLER(SDKLIB_ClearClipBoard, HANDLE_NAMEONLY, "ClearClipBoard", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetClipBoardTextLength, HANDLE_NAMEONLY, "GetClipBoardTextLength", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetSysTime, HANDLE_IMPLEMENTED, "GetSysTime", Bind<&GetSysTime>),
+	REGISTER_HANDLER(SDKLIB_SetSysTime, HANDLE_NAMEONLY, "SetSysTime", nullptr),
+	REGISTER_HANDLER(SDKLIB_PopupWaitingMsg, HANDLE_NAMEONLY, "PopupWaitingMsg", nullptr),
+	REGISTER_HANDLER(SDKLIB_CloseWaitingMsg, HANDLE_NAMEONLY, "CloseWaitingMsg", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetLanguageType, HANDLE_NAMEONLY, "GetLanguageType", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetLanguageType, HANDLE_NAMEONLY, "SetLanguageType", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetChineseFont, HANDLE_NAMEONLY, "SetChineseFont", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetChineseFont, HANDLE_NAMEONLY, "GetChineseFont", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetShiftState, HANDLE_NAMEONLY, "SetShiftState", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetCapsState, HANDLE_NAMEONLY, "SetCapsState", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetShiftState, HANDLE_NAMEONLY, "GetShiftState", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetCapsState, HANDLE_NAMEONLY, "GetCapsState", nullptr),
+	REGISTER_HANDLER(SDKLIB_Tradional2Simple, HANDLE_NAMEONLY, "Tradional2Simple", nullptr),
+	REGISTER_HANDLER(SDKLIB_Simple2Tradional, HANDLE_NAMEONLY, "Simple2Tradional", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetEPTSLastChar, HANDLE_NAMEONLY, "SetEPTSLastChar", nullptr),
+	REGISTER_HANDLER(SDKLIB_PlayAllVoice, HANDLE_NAMEONLY, "PlayAllVoice", nullptr),
+	REGISTER_HANDLER(SDKLIB_StopAllVoice, HANDLE_NAMEONLY, "StopAllVoice", nullptr),
+	REGISTER_HANDLER(SDKLIB_PauseAllVoice, HANDLE_NAMEONLY, "PauseAllVoice", nullptr),
+	REGISTER_HANDLER(SDKLIB_ContinueAllVoice, HANDLE_NAMEONLY, "ContinueAllVoice", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetAllVoiceState, HANDLE_NAMEONLY, "GetAllVoiceState", nullptr),
+	REGISTER_HANDLER(SDKLIB_RecordVoiceEx, HANDLE_NAMEONLY, "RecordVoiceEx", nullptr),
+	REGISTER_HANDLER(SDKLIB_PlaybackVoiceEx, HANDLE_NAMEONLY, "PlaybackVoiceEx", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetAudioHandler, HANDLE_NAMEONLY, "SetAudioHandler", nullptr),
+	REGISTER_HANDLER(SDKLIB_ConvCharToUnicode, HANDLE_NAMEONLY, "ConvCharToUnicode", nullptr),
+	REGISTER_HANDLER(SDKLIB_ConvStrToUnicode, HANDLE_NAMEONLY, "ConvStrToUnicode", nullptr),
+	REGISTER_HANDLER(SDKLIB_CompSecretkey, HANDLE_NAMEONLY, "CompSecretkey", nullptr),
+	REGISTER_HANDLER(SDKLIB_ClearSecretkey, HANDLE_NAMEONLY, "ClearSecretkey", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetUserFontHandle, HANDLE_NAMEONLY, "SetUserFontHandle", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetMasterIDInfo, HANDLE_NAMEONLY, "GetMasterIDInfo", GetMasterIDInfo),
+	REGISTER_HANDLER(SDKLIB_ReadFollowMe, HANDLE_NAMEONLY, "ReadFollowMe", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetPrivateState, HANDLE_NAMEONLY, "GetPrivateState", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetPrivateState, HANDLE_NAMEONLY, "SetPrivateState", nullptr),
+	REGISTER_HANDLER(SDKLIB__afnsplit, HANDLE_NAMEONLY, "_afnsplit", nullptr),
+	REGISTER_HANDLER(SDKLIB__afnmerge, HANDLE_NAMEONLY, "_afnmerge", nullptr),
+	REGISTER_HANDLER(SDKLIB__afcreate, HANDLE_NAMEONLY, "_afcreate", nullptr),
+	REGISTER_HANDLER(SDKLIB__afcreateSz, HANDLE_NAMEONLY, "_afcreateSz", nullptr),
+	REGISTER_HANDLER(SDKLIB__afopen, HANDLE_NAMEONLY, "_afopen", nullptr),
+	REGISTER_HANDLER(SDKLIB__fclose, HANDLE_IMPLEMENTED, "_fclose", Bind<&_fclose>),
+	REGISTER_HANDLER(SDKLIB__filesize, HANDLE_NAMEONLY, "_filesize", Bind<&_filesize>),
+	REGISTER_HANDLER(SDKLIB___fflush, HANDLE_NAMEONLY, "__fflush", nullptr),
+	REGISTER_HANDLER(SDKLIB__fflushall, HANDLE_NAMEONLY, "_fflushall", nullptr),
+	REGISTER_HANDLER(SDKLIB__rewind, HANDLE_NAMEONLY, "_rewind", nullptr),
+	REGISTER_HANDLER(SDKLIB___fseek, HANDLE_NAMEONLY, "__fseek", nullptr),
+	REGISTER_HANDLER(SDKLIB__ftell, HANDLE_NAMEONLY, "_ftell", nullptr),
+	REGISTER_HANDLER(SDKLIB__feof, HANDLE_NAMEONLY, "_feof", nullptr),
+	REGISTER_HANDLER(SDKLIB__fgetc, HANDLE_NAMEONLY, "_fgetc", nullptr),
+	REGISTER_HANDLER(SDKLIB__fgets, HANDLE_NAMEONLY, "_fgets", nullptr),
+	REGISTER_HANDLER(SDKLIB__fread, HANDLE_NAMEONLY, "_fread", Bind<&_fread>),
+	REGISTER_HANDLER(SDKLIB__fputc, HANDLE_NAMEONLY, "_fputc", nullptr),
+	REGISTER_HANDLER(SDKLIB__fputs, HANDLE_NAMEONLY, "_fputs", nullptr),
+	REGISTER_HANDLER(SDKLIB__fwrite, HANDLE_IMPLEMENTED, "_fwrite", Bind<&_fwrite>),
+	REGISTER_HANDLER(SDKLIB__afindfirst, HANDLE_NAMEONLY, "_afindfirst", _afindfirst),
+	REGISTER_HANDLER(SDKLIB__afindnext, HANDLE_NAMEONLY, "_afindnext", _afindnext),
+	REGISTER_HANDLER(SDKLIB__findclose, HANDLE_NAMEONLY, "_findclose", _findclose),
+	REGISTER_HANDLER(SDKLIB__afgetattr, HANDLE_NAMEONLY, "_afgetattr", nullptr),
+	REGISTER_HANDLER(SDKLIB__afsetattr, HANDLE_NAMEONLY, "_afsetattr", nullptr),
+	REGISTER_HANDLER(SDKLIB__aremove, HANDLE_NAMEONLY, "_aremove", _aremove),
+	REGISTER_HANDLER(SDKLIB__arename, HANDLE_NAMEONLY, "_arename", nullptr),
+	REGISTER_HANDLER(SDKLIB__afcopy, HANDLE_NAMEONLY, "_afcopy", nullptr),
+	REGISTER_HANDLER(SDKLIB__amkdir, HANDLE_IMPLEMENTED, "_amkdir", _amkdir),
+	REGISTER_HANDLER(SDKLIB__armdir, HANDLE_NAMEONLY, "_armdir", nullptr),
+	REGISTER_HANDLER(SDKLIB__achdir, HANDLE_IMPLEMENTED, "_achdir", _achdir),
+	REGISTER_HANDLER(SDKLIB__agetcurdir, HANDLE_NAMEONLY, "_agetcurdir", nullptr),
+	REGISTER_HANDLER(SDKLIB__isformateddisk, HANDLE_NAMEONLY, "_isformateddisk", nullptr),
+	REGISTER_HANDLER(SDKLIB__getfattype, HANDLE_NAMEONLY, "_getfattype", nullptr),
+	REGISTER_HANDLER(SDKLIB__setdisk, HANDLE_NAMEONLY, "_setdisk", nullptr),
+	REGISTER_HANDLER(SDKLIB__getdisk, HANDLE_NAMEONLY, "_getdisk", nullptr),
+	REGISTER_HANDLER(SDKLIB__getdiskchar, HANDLE_NAMEONLY, "_getdiskchar", nullptr),
+	REGISTER_HANDLER(SDKLIB__setdiskchar, HANDLE_NAMEONLY, "_setdiskchar", nullptr),
+	REGISTER_HANDLER(SDKLIB__getdisknum, HANDLE_NAMEONLY, "_getdisknum", nullptr),
+	REGISTER_HANDLER(SDKLIB_FSGetDiskRoomState, HANDLE_NAMEONLY, "FSGetDiskRoomState", nullptr),
+	REGISTER_HANDLER(SDKLIB__OpenFile, HANDLE_IMPLEMENTED, "_OpenFile", _OpenFile),
+	REGISTER_HANDLER(SDKLIB__OpenFileEx, HANDLE_NAMEONLY, "_OpenFileEx", nullptr),
+	REGISTER_HANDLER(SDKLIB__OpenFileW, HANDLE_NAMEONLY, "_OpenFileW", nullptr),
+	REGISTER_HANDLER(SDKLIB__CloseFile, HANDLE_NAMEONLY, "_CloseFile", nullptr),
+	REGISTER_HANDLER(SDKLIB__ReadFile, HANDLE_NAMEONLY, "_ReadFile", nullptr),
+	REGISTER_HANDLER(SDKLIB__FseekFile, HANDLE_NAMEONLY, "_FseekFile", nullptr),
+	REGISTER_HANDLER(SDKLIB__FileSize, HANDLE_NAMEONLY, "_FileSize", nullptr),
+	REGISTER_HANDLER(SDKLIB__OpenSubFile, HANDLE_NAMEONLY, "_OpenSubFile", nullptr),
+	REGISTER_HANDLER(SDKLIB__TellFile, HANDLE_NAMEONLY, "_TellFile", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBSave, HANDLE_NAMEONLY, "DBSave", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBSaveAll, HANDLE_NAMEONLY, "DBSaveAll", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBOpenUserFile, HANDLE_NAMEONLY, "DBOpenUserFile", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBCreate, HANDLE_NAMEONLY, "DBCreate", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBCreateSZ, HANDLE_NAMEONLY, "DBCreateSZ", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBOpen, HANDLE_NAMEONLY, "DBOpen", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBClose, HANDLE_NAMEONLY, "DBClose", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBRemove, HANDLE_NAMEONLY, "DBRemove", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBEmpty, HANDLE_NAMEONLY, "DBEmpty", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBOptimize, HANDLE_NAMEONLY, "DBOptimize", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBRepair, HANDLE_NAMEONLY, "DBRepair", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBGetNewRecordPID, HANDLE_NAMEONLY, "DBGetNewRecordPID", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBGetNewRecordID, HANDLE_NAMEONLY, "DBGetNewRecordID", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBCreateNewRecord, HANDLE_NAMEONLY, "DBCreateNewRecord", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBInsertRecord, HANDLE_NAMEONLY, "DBInsertRecord", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBModifyRecord, HANDLE_NAMEONLY, "DBModifyRecord", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBRemoveRecord, HANDLE_NAMEONLY, "DBRemoveRecord", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBReadRecord, HANDLE_NAMEONLY, "DBReadRecord", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBGetRecordTime, HANDLE_NAMEONLY, "DBGetRecordTime", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBGetRecordDate, HANDLE_NAMEONLY, "DBGetRecordDate", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBGetRecordPid, HANDLE_NAMEONLY, "DBGetRecordPid", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBGetCurRecordCount, HANDLE_NAMEONLY, "DBGetCurRecordCount", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBOverLoadSortFunc, HANDLE_NAMEONLY, "DBOverLoadSortFunc", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBGetRecPidState, HANDLE_NAMEONLY, "DBGetRecPidState", nullptr),
+	REGISTER_HANDLER(SDKLIB_DBGetDBState, HANDLE_NAMEONLY, "DBGetDBState", nullptr),
+	REGISTER_HANDLER(SDKLIB__GetSystemDirectory, HANDLE_NAMEONLY, "_GetSystemDirectory", nullptr),
+	REGISTER_HANDLER(SDKLIB__GetTempPath, HANDLE_NAMEONLY, "_GetTempPath", nullptr),
+	REGISTER_HANDLER(SDKLIB__GetPrivateProfileInt, HANDLE_NAMEONLY, "_GetPrivateProfileInt", nullptr),
+	REGISTER_HANDLER(SDKLIB__GetPrivateProfileString, HANDLE_IMPLEMENTED, "_GetPrivateProfileString", Bind<&_GetPrivateProfileString>),
+	REGISTER_HANDLER(SDKLIB__WritePrivateProfileString, HANDLE_NAMEONLY, "_WritePrivateProfileString", _SetPrivateProfileString),
+	REGISTER_HANDLER(SDKLIB_GetTadCityNo, HANDLE_NAMEONLY, "GetTadCityNo", nullptr),
+	REGISTER_HANDLER(SDKLIB_RunApplicationA, HANDLE_NAMEONLY, "RunApplicationA", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetApplicationNameA, HANDLE_NAMEONLY, "GetApplicationNameA", nullptr),
+	REGISTER_HANDLER(SDKLIB_LoadProgramA, HANDLE_NAMEONLY, "LoadProgramA", nullptr),
+	REGISTER_HANDLER(SDKLIB_FreeProgram, HANDLE_NAMEONLY, "FreeProgram", nullptr),
+	REGISTER_HANDLER(SDKLIB_ExecuteProgram, HANDLE_NAMEONLY, "ExecuteProgram", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetCurrentPathA, HANDLE_IMPLEMENTED, "GetCurrentPathA", GetCurrentExecutable),
+	REGISTER_HANDLER(SDKLIB_ProgramIsRunningA, HANDLE_IMPLEMENTED, "ProgramIsRunningA", prgrmIsRunning),
+	REGISTER_HANDLER(SDKLIB_FindApplications, HANDLE_NAMEONLY, "FindApplications", nullptr),
+	REGISTER_HANDLER(SDKLIB_FreeFindApplications, HANDLE_NAMEONLY, "FreeFindApplications", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetApplicationInfo, HANDLE_NAMEONLY, "GetApplicationInfo", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateAppView, HANDLE_NAMEONLY, "CreateAppView", nullptr),
+	REGISTER_HANDLER(SDKLIB_TextPicker, HANDLE_NAMEONLY, "TextPicker", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetMonDays, HANDLE_NAMEONLY, "GetMonDays", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetWeekDay, HANDLE_NAMEONLY, "GetWeekDay", nullptr),
+	REGISTER_HANDLER(SDKLIB_ConvSolarToLunar, HANDLE_NAMEONLY, "ConvSolarToLunar", nullptr),
+	REGISTER_HANDLER(SDKLIB_ConvLunarToSolar, HANDLE_NAMEONLY, "ConvLunarToSolar", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetLeapMonth, HANDLE_NAMEONLY, "GetLeapMonth", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateEdit, HANDLE_NAMEONLY, "CreateEdit", nullptr),
+	REGISTER_HANDLER(SDKLIB_EDInitEdit, HANDLE_NAMEONLY, "EDInitEdit", nullptr),
+	REGISTER_HANDLER(SDKLIB_EDDraw, HANDLE_NAMEONLY, "EDDraw", nullptr),
+	REGISTER_HANDLER(SDKLIB_EDDrawText, HANDLE_NAMEONLY, "EDDrawText", nullptr),
+	REGISTER_HANDLER(SDKLIB_EDHandleEvent, HANDLE_NAMEONLY, "EDHandleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_InsertTextField, HANDLE_NAMEONLY, "InsertTextField", nullptr),
+	REGISTER_HANDLER(SDKLIB_ReplaceEditBuffer, HANDLE_NAMEONLY, "ReplaceEditBuffer", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetEditCmdFunc, HANDLE_NAMEONLY, "SetEditCmdFunc", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetEditCmdFunc, HANDLE_NAMEONLY, "GetEditCmdFunc", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetEditFunctionMenuState, HANDLE_NAMEONLY, "SetEditFunctionMenuState", nullptr),
+	REGISTER_HANDLER(SDKLIB_DatePicker, HANDLE_NAMEONLY, "DatePicker", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateBoolDateField, HANDLE_NAMEONLY, "CreateBoolDateField", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateBoolMenuField, HANDLE_NAMEONLY, "CreateBoolMenuField", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateBoolField, HANDLE_NAMEONLY, "CreateBoolField", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateBoolTextField, HANDLE_NAMEONLY, "CreateBoolTextField", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateTimeField, HANDLE_NAMEONLY, "CreateTimeField", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateDateField, HANDLE_NAMEONLY, "CreateDateField", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateDoubleTimeField, HANDLE_NAMEONLY, "CreateDoubleTimeField", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateNumericField, HANDLE_NAMEONLY, "CreateNumericField", nullptr),
+	REGISTER_HANDLER(SDKLIB_PDATEFIELD_draw, HANDLE_NAMEONLY, "PDATEFIELD_draw", nullptr),
+	REGISTER_HANDLER(SDKLIB_PDATEFIELD_handleEvent, HANDLE_NAMEONLY, "PDATEFIELD_handleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_PDATEFIELD_setState, HANDLE_NAMEONLY, "PDATEFIELD_setState", nullptr),
+	REGISTER_HANDLER(SDKLIB_PNUMERICFIELD_handleEvent, HANDLE_NAMEONLY, "PNUMERICFIELD_handleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_PBOOLFIELD_draw, HANDLE_NAMEONLY, "PBOOLFIELD_draw", nullptr),
+	REGISTER_HANDLER(SDKLIB_MessageBox, HANDLE_NAMEONLY, "MessageBox", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateMessageBox, HANDLE_NAMEONLY, "CreateMessageBox", nullptr),
+	REGISTER_HANDLER(SDKLIB_NumericPicker, HANDLE_NAMEONLY, "NumericPicker", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetNumPkValidHandle, HANDLE_NAMEONLY, "SetNumPkValidHandle", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateDetailView, HANDLE_NAMEONLY, "CreateDetailView", nullptr),
+	REGISTER_HANDLER(SDKLIB_PDETAILVIEW_draw, HANDLE_NAMEONLY, "PDETAILVIEW_draw", nullptr),
+	REGISTER_HANDLER(SDKLIB_NumericToStr, HANDLE_NAMEONLY, "NumericToStr", nullptr),
+	REGISTER_HANDLER(SDKLIB_StrToNumeric, HANDLE_NAMEONLY, "StrToNumeric", nullptr),
+	REGISTER_HANDLER(SDKLIB_AllocBlock, HANDLE_NAMEONLY, "AllocBlock", nullptr),
+	REGISTER_HANDLER(SDKLIB_FreeBlock, HANDLE_NAMEONLY, "FreeBlock", nullptr),
+	REGISTER_HANDLER(SDKLIB_RelatedKeyButton, HANDLE_NAMEONLY, "RelatedKeyButton", nullptr),
+	REGISTER_HANDLER(SDKLIB_RelatedKeyButtonEx, HANDLE_NAMEONLY, "RelatedKeyButtonEx", nullptr),
+	REGISTER_HANDLER(SDKLIB_UnRelatedKeyButton, HANDLE_NAMEONLY, "UnRelatedKeyButton", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateButton, HANDLE_NAMEONLY, "CreateButton", nullptr),
+	REGISTER_HANDLER(SDKLIB_ChangeButton, HANDLE_NAMEONLY, "ChangeButton", nullptr),
+	REGISTER_HANDLER(SDKLIB_InsertButton, HANDLE_NAMEONLY, "InsertButton", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateStatic, HANDLE_NAMEONLY, "CreateStatic", nullptr),
+	REGISTER_HANDLER(SDKLIB_PBUTTON_draw, HANDLE_NAMEONLY, "PBUTTON_draw", nullptr),
+	REGISTER_HANDLER(SDKLIB_InsertImageClip, HANDLE_NAMEONLY, "InsertImageClip", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreatePageArrow, HANDLE_NAMEONLY, "CreatePageArrow", nullptr),
+	REGISTER_HANDLER(SDKLIB_InsertPgUpDn, HANDLE_NAMEONLY, "InsertPgUpDn", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateHorPageArrow, HANDLE_NAMEONLY, "CreateHorPageArrow", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateControlMenu, HANDLE_NAMEONLY, "CreateControlMenu", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateMenuField, HANDLE_NAMEONLY, "CreateMenuField", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateNumberSet, HANDLE_NAMEONLY, "CreateNumberSet", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateStackedList, HANDLE_NAMEONLY, "CreateStackedList", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateSlider, HANDLE_NAMEONLY, "CreateSlider", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateProgress, HANDLE_NAMEONLY, "CreateProgress", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateRadioButton, HANDLE_NAMEONLY, "CreateRadioButton", nullptr),
+	REGISTER_HANDLER(SDKLIB_PPROGRESSetPos, HANDLE_NAMEONLY, "PPROGRESSetPos", nullptr),
+	REGISTER_HANDLER(SDKLIB_PPROGRESSetRange, HANDLE_NAMEONLY, "PPROGRESSetRange", nullptr),
+	REGISTER_HANDLER(SDKLIB_PSLIDER_SetPos, HANDLE_NAMEONLY, "PSLIDER_SetPos", nullptr),
+	REGISTER_HANDLER(SDKLIB_PSLIDER_SetRange, HANDLE_NAMEONLY, "PSLIDER_SetRange", nullptr),
+	REGISTER_HANDLER(SDKLIB_PSLIDER_handleEvent, HANDLE_NAMEONLY, "PSLIDER_handleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_IsRadioButtonCheck, HANDLE_NAMEONLY, "IsRadioButtonCheck", nullptr),
+	REGISTER_HANDLER(SDKLIB_CheckDeskRadioButton, HANDLE_NAMEONLY, "CheckDeskRadioButton", nullptr),
+	REGISTER_HANDLER(SDKLIB_PNUMBERSET_handleEvent, HANDLE_NAMEONLY, "PNUMBERSET_handleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_PMENUFIELD_draw, HANDLE_NAMEONLY, "PMENUFIELD_draw", nullptr),
+	REGISTER_HANDLER(SDKLIB_PMENUFIELD_handleEvent, HANDLE_NAMEONLY, "PMENUFIELD_handleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_PCONTROLMENU_draw, HANDLE_NAMEONLY, "PCONTROLMENU_draw", nullptr),
+	REGISTER_HANDLER(SDKLIB_PCONTROLMENU_handleEvent, HANDLE_NAMEONLY, "PCONTROLMENU_handleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_PVIEW_draw, HANDLE_NAMEONLY, "PVIEW_draw", nullptr),
+	REGISTER_HANDLER(SDKLIB_PVIEW_EraseBackGround, HANDLE_NAMEONLY, "PVIEW_EraseBackGround", nullptr),
+	REGISTER_HANDLER(SDKLIB_PVIEW_handleEvent, HANDLE_NAMEONLY, "PVIEW_handleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_PVIEW_setState, HANDLE_NAMEONLY, "PVIEW_setState", nullptr),
+	REGISTER_HANDLER(SDKLIB_PGROUP_draw, HANDLE_NAMEONLY, "PGROUP_draw", nullptr),
+	REGISTER_HANDLER(SDKLIB_PGROUP_handleEvent, HANDLE_NAMEONLY, "PGROUP_handleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_PGROUP_insert, HANDLE_NAMEONLY, "PGROUP_insert", nullptr),
+	REGISTER_HANDLER(SDKLIB_PGROUP_redraw, HANDLE_NAMEONLY, "PGROUP_redraw", nullptr),
+	REGISTER_HANDLER(SDKLIB_PGROUP_setCurrent, HANDLE_NAMEONLY, "PGROUP_setCurrent", nullptr),
+	REGISTER_HANDLER(SDKLIB_PGROUP_setState, HANDLE_NAMEONLY, "PGROUP_setState", nullptr),
+	REGISTER_HANDLER(SDKLIB_PGROUP_execute, HANDLE_NAMEONLY, "PGROUP_execute", nullptr),
+	REGISTER_HANDLER(SDKLIB_PGROUP_preView, HANDLE_NAMEONLY, "PGROUP_preView", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateDeskBox, HANDLE_NAMEONLY, "CreateDeskBox", nullptr),
+	REGISTER_HANDLER(SDKLIB_PDESKBOX_draw, HANDLE_NAMEONLY, "PDESKBOX_draw", nullptr),
+	REGISTER_HANDLER(SDKLIB_PDESKBOX_drawTitle, HANDLE_NAMEONLY, "PDESKBOX_drawTitle", nullptr),
+	REGISTER_HANDLER(SDKLIB_PDESKBOX_handleEvent, HANDLE_NAMEONLY, "PDESKBOX_handleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_PDESKBOX_redraw, HANDLE_NAMEONLY, "PDESKBOX_redraw", nullptr),
+	REGISTER_HANDLER(SDKLIB_Destroy, HANDLE_NAMEONLY, "Destroy", nullptr),
+	REGISTER_HANDLER(SDKLIB_DeskBox_construct, HANDLE_NAMEONLY, "DeskBox_construct", nullptr),
+	REGISTER_HANDLER(SDKLIB_DrawDeskBoxBound, HANDLE_NAMEONLY, "DrawDeskBoxBound", nullptr),
+	REGISTER_HANDLER(SDKLIB_ChangeCommandMenu, HANDLE_NAMEONLY, "ChangeCommandMenu", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetDeskBoxReturn, HANDLE_NAMEONLY, "SetDeskBoxReturn", nullptr),
+	REGISTER_HANDLER(SDKLIB_ExecView, HANDLE_NAMEONLY, "ExecView", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetExitWordVal, HANDLE_NAMEONLY, "SetExitWordVal", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetExitWordVal, HANDLE_NAMEONLY, "GetExitWordVal", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetCurModeWord, HANDLE_NAMEONLY, "SetCurModeWord", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetCurModeWord, HANDLE_NAMEONLY, "GetCurModeWord", nullptr),
+	REGISTER_HANDLER(SDKLIB_InsertTitleBarButton, HANDLE_NAMEONLY, "InsertTitleBarButton", nullptr),
+	REGISTER_HANDLER(SDKLIB_Delete, HANDLE_NAMEONLY, "Delete", nullptr),
+	REGISTER_HANDLER(SDKLIB_DisableCommand, HANDLE_NAMEONLY, "DisableCommand", nullptr),
+	REGISTER_HANDLER(SDKLIB_EnableCommand, HANDLE_NAMEONLY, "EnableCommand", nullptr),
+	REGISTER_HANDLER(SDKLIB_InverseSetAreaArc, HANDLE_NAMEONLY, "InverseSetAreaArc", nullptr),
+	REGISTER_HANDLER(SDKLIB_InverseSetAreaColor, HANDLE_NAMEONLY, "InverseSetAreaColor", nullptr),
+	REGISTER_HANDLER(SDKLIB_InverseSetAreaArcColor, HANDLE_NAMEONLY, "InverseSetAreaArcColor", nullptr),
+	REGISTER_HANDLER(SDKLIB_SendMessage, HANDLE_NAMEONLY, "SendMessage", nullptr),
+	REGISTER_HANDLER(SDKLIB_SendMessageExt, HANDLE_NAMEONLY, "SendMessageExt", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetPreView, HANDLE_NAMEONLY, "GetPreView", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetFocuseItem, HANDLE_NAMEONLY, "SetFocuseItem", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetTabOrder, HANDLE_NAMEONLY, "SetTabOrder", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetDeskEntry, HANDLE_NAMEONLY, "GetDeskEntry", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetDeskItem, HANDLE_NAMEONLY, "GetDeskItem", nullptr),
+	REGISTER_HANDLER(SDKLIB_QueryByCommand, HANDLE_NAMEONLY, "QueryByCommand", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetMaxScrX, HANDLE_NAMEONLY, "GetMaxScrX", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetMaxScrY, HANDLE_NAMEONLY, "GetMaxScrY", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetDeskClientRect, HANDLE_NAMEONLY, "GetDeskClientRect", nullptr),
+	REGISTER_HANDLER(SDKLIB_InvalidateRect, HANDLE_NAMEONLY, "InvalidateRect", nullptr),
+	REGISTER_HANDLER(SDKLIB_InsertSplitViewFrame, HANDLE_NAMEONLY, "InsertSplitViewFrame", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateSplitView, HANDLE_NAMEONLY, "CreateSplitView", nullptr),
+	REGISTER_HANDLER(SDKLIB_InsertSplitView, HANDLE_NAMEONLY, "InsertSplitView", nullptr),
+	REGISTER_HANDLER(SDKLIB_PSPLITVIEW_draw, HANDLE_NAMEONLY, "PSPLITVIEW_draw", nullptr),
+	REGISTER_HANDLER(SDKLIB_PSPLITVIEW_handleEvent, HANDLE_NAMEONLY, "PSPLITVIEW_handleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_PSPLITVIEW_setState, HANDLE_NAMEONLY, "PSPLITVIEW_setState", nullptr),
+	REGISTER_HANDLER(SDKLIB_InsertMultiPage, HANDLE_NAMEONLY, "InsertMultiPage", nullptr),
+	REGISTER_HANDLER(SDKLIB_PPAGE_draw, HANDLE_NAMEONLY, "PPAGE_draw", nullptr),
+	REGISTER_HANDLER(SDKLIB_PPAGE_handleEvent, HANDLE_NAMEONLY, "PPAGE_handleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_PMPAGE_insertPage, HANDLE_NAMEONLY, "PMPAGE_insertPage", nullptr),
+	REGISTER_HANDLER(SDKLIB_PMPAGE_handleEvent, HANDLE_NAMEONLY, "PMPAGE_handleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_ConverNumToStr, HANDLE_NAMEONLY, "ConverNumToStr", nullptr),
+	REGISTER_HANDLER(SDKLIB_ConverTimeToStr, HANDLE_NAMEONLY, "ConverTimeToStr", nullptr),
+	REGISTER_HANDLER(SDKLIB_DateToString, HANDLE_NAMEONLY, "DateToString", nullptr),
+	REGISTER_HANDLER(SDKLIB_TimeToString, HANDLE_NAMEONLY, "TimeToString", nullptr),
+	REGISTER_HANDLER(SDKLIB_ZfxGetWeekDay, HANDLE_NAMEONLY, "ZfxGetWeekDay", nullptr),
+	REGISTER_HANDLER(SDKLIB_WriteNumber, HANDLE_NAMEONLY, "WriteNumber", nullptr),
+	REGISTER_HANDLER(SDKLIB_ConverDateToStr, HANDLE_NAMEONLY, "ConverDateToStr", nullptr),
+	REGISTER_HANDLER(SDKLIB_PopUpList, HANDLE_NAMEONLY, "PopUpList", nullptr),
+	REGISTER_HANDLER(SDKLIB_PressAtRange, HANDLE_NAMEONLY, "PressAtRange", nullptr),
+	REGISTER_HANDLER(SDKLIB_PressAtButton, HANDLE_NAMEONLY, "PressAtButton", nullptr),
+	REGISTER_HANDLER(SDKLIB_PressAtButtonInv, HANDLE_NAMEONLY, "PressAtButtonInv", nullptr),
+	REGISTER_HANDLER(SDKLIB_PressAtButtonIconAddr, HANDLE_NAMEONLY, "PressAtButtonIconAddr", nullptr),
+	REGISTER_HANDLER(SDKLIB_PressAtButtonIcon, HANDLE_NAMEONLY, "PressAtButtonIcon", nullptr),
+	REGISTER_HANDLER(SDKLIB_IsSystemItemID, HANDLE_NAMEONLY, "IsSystemItemID", nullptr),
+	REGISTER_HANDLER(SDKLIB_WaitingMessageBox, HANDLE_NAMEONLY, "WaitingMessageBox", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateCalendar, HANDLE_NAMEONLY, "CreateCalendar", nullptr),
+	REGISTER_HANDLER(SDKLIB_PCALENDAR_draw, HANDLE_NAMEONLY, "PCALENDAR_draw", nullptr),
+	REGISTER_HANDLER(SDKLIB_PCALENDAR_handleEvent, HANDLE_NAMEONLY, "PCALENDAR_handleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateScrollBar, HANDLE_NAMEONLY, "CreateScrollBar", nullptr),
+	REGISTER_HANDLER(SDKLIB_InsertScrollBar, HANDLE_NAMEONLY, "InsertScrollBar", nullptr),
+	REGISTER_HANDLER(SDKLIB_InsertScrollBarPosition, HANDLE_NAMEONLY, "InsertScrollBarPosition", nullptr),
+	REGISTER_HANDLER(SDKLIB_PSCROLLBAR_draw, HANDLE_NAMEONLY, "PSCROLLBAR_draw", nullptr),
+	REGISTER_HANDLER(SDKLIB_PSCROLLBAR_redraw, HANDLE_NAMEONLY, "PSCROLLBAR_redraw", nullptr),
+	REGISTER_HANDLER(SDKLIB_PSCROLLBAR_handleEvent, HANDLE_NAMEONLY, "PSCROLLBAR_handleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_ChangeScrollBarValue, HANDLE_NAMEONLY, "ChangeScrollBarValue", nullptr),
+	REGISTER_HANDLER(SDKLIB_ChangeScrollBarStep, HANDLE_NAMEONLY, "ChangeScrollBarStep", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetScrollBarValue, HANDLE_NAMEONLY, "SetScrollBarValue", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetScrollBarStep, HANDLE_NAMEONLY, "SetScrollBarStep", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateLister, HANDLE_NAMEONLY, "CreateLister", nullptr),
+	REGISTER_HANDLER(SDKLIB_PLISTER_draw, HANDLE_NAMEONLY, "PLISTER_draw", nullptr),
+	REGISTER_HANDLER(SDKLIB_PLISTER_handleEvent, HANDLE_NAMEONLY, "PLISTER_handleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_PLISTER_writeItem, HANDLE_NAMEONLY, "PLISTER_writeItem", nullptr),
+	REGISTER_HANDLER(SDKLIB_PLISTER_penDownAct, HANDLE_NAMEONLY, "PLISTER_penDownAct", nullptr),
+	REGISTER_HANDLER(SDKLIB_PLISTER_changeFocuseAct, HANDLE_NAMEONLY, "PLISTER_changeFocuseAct", nullptr),
+	REGISTER_HANDLER(SDKLIB_ChangeListRowHeight, HANDLE_NAMEONLY, "ChangeListRowHeight", nullptr),
+	REGISTER_HANDLER(SDKLIB_ChangeListItemSum, HANDLE_NAMEONLY, "ChangeListItemSum", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateLongLister, HANDLE_NAMEONLY, "CreateLongLister", nullptr),
+	REGISTER_HANDLER(SDKLIB_PLONGLISTER_draw, HANDLE_NAMEONLY, "PLONGLISTER_draw", nullptr),
+	REGISTER_HANDLER(SDKLIB_PLONGLISTER_handleEvent, HANDLE_NAMEONLY, "PLONGLISTER_handleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_PLONGLISTER_changeFocuseAct, HANDLE_NAMEONLY, "PLONGLISTER_changeFocuseAct", nullptr),
+	REGISTER_HANDLER(SDKLIB_PLONGLISTER_writeItem, HANDLE_NAMEONLY, "PLONGLISTER_writeItem", nullptr),
+	REGISTER_HANDLER(SDKLIB_PLONGLISTER_penDownAct, HANDLE_NAMEONLY, "PLONGLISTER_penDownAct", nullptr),
+	REGISTER_HANDLER(SDKLIB_ChangeLongListItemSum, HANDLE_NAMEONLY, "ChangeLongListItemSum", nullptr),
+	REGISTER_HANDLER(SDKLIB_ChangeLongListRowHeight, HANDLE_NAMEONLY, "ChangeLongListRowHeight", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetSysColorConfig, HANDLE_NAMEONLY, "SetSysColorConfig", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetSysColorConfig, HANDLE_NAMEONLY, "GetSysColorConfig", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetSysColor, HANDLE_NAMEONLY, "GetSysColor", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetSysColor, HANDLE_NAMEONLY, "SetSysColor", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetDefaultSysIconCfg, HANDLE_NAMEONLY, "SetDefaultSysIconCfg", nullptr),
+	REGISTER_HANDLER(SDKLIB_DrawGradientRect, HANDLE_NAMEONLY, "DrawGradientRect", nullptr),
+	REGISTER_HANDLER(SDKLIB_TimePicker, HANDLE_NAMEONLY, "TimePicker", nullptr),
+	REGISTER_HANDLER(SDKLIB__GetOpenFileName, HANDLE_NAMEONLY, "_GetOpenFileName", nullptr),
+	REGISTER_HANDLER(SDKLIB__GetSaveFileName, HANDLE_NAMEONLY, "_GetSaveFileName", nullptr),
+	REGISTER_HANDLER(SDKLIB__GetNextFileName, HANDLE_NAMEONLY, "_GetNextFileName", nullptr),
+	REGISTER_HANDLER(SDKLIB_InsertFileFilter, HANDLE_NAMEONLY, "InsertFileFilter", nullptr),
+	REGISTER_HANDLER(SDKLIB_PFILEFILTER_draw, HANDLE_NAMEONLY, "PFILEFILTER_draw", nullptr),
+	REGISTER_HANDLER(SDKLIB_PFILEFILTER_handleEvent, HANDLE_NAMEONLY, "PFILEFILTER_handleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_PFILEFILTER_chgColumnText, HANDLE_NAMEONLY, "PFILEFILTER_chgColumnText", nullptr),
+	REGISTER_HANDLER(SDKLIB_PFILEFILTER_setPathInfo, HANDLE_NAMEONLY, "PFILEFILTER_setPathInfo", nullptr),
+	REGISTER_HANDLER(SDKLIB_PFILEFILTER_getFillMode, HANDLE_NAMEONLY, "PFILEFILTER_getFillMode", nullptr),
+	REGISTER_HANDLER(SDKLIB_PFILEFILTER_setFillMode, HANDLE_NAMEONLY, "PFILEFILTER_setFillMode", nullptr),
+	REGISTER_HANDLER(SDKLIB_PFILEFILTER_getItemName, HANDLE_NAMEONLY, "PFILEFILTER_getItemName", nullptr),
+	REGISTER_HANDLER(SDKLIB_PFILEFILTER_writeColumn0, HANDLE_NAMEONLY, "PFILEFILTER_writeColumn0", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetFileExecuteFunction, HANDLE_NAMEONLY, "GetFileExecuteFunction", nullptr),
+	REGISTER_HANDLER(SDKLIB__EditFileName, HANDLE_NAMEONLY, "_EditFileName", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_GetHandActiveState, HANDLE_NAMEONLY, "IME_GetHandActiveState", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_GetCtrlSize, HANDLE_NAMEONLY, "IME_GetCtrlSize", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_ActiveCtrl, HANDLE_NAMEONLY, "IME_ActiveCtrl", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_IsActiveInputer, HANDLE_NAMEONLY, "IME_IsActiveInputer", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_SetDefault, HANDLE_NAMEONLY, "IME_SetDefault", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_GetLXResult, HANDLE_NAMEONLY, "IME_GetLXResult", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_SetHandFilter, HANDLE_NAMEONLY, "IME_SetHandFilter", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_GetHandFilter, HANDLE_NAMEONLY, "IME_GetHandFilter", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_IsFuncKey, HANDLE_NAMEONLY, "IME_IsFuncKey", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_SearchKeyMap, HANDLE_NAMEONLY, "IME_SearchKeyMap", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_IsSelectKey, HANDLE_NAMEONLY, "IME_IsSelectKey", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_SaveUserInfo, HANDLE_NAMEONLY, "IME_SaveUserInfo", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_ReadUserInfo, HANDLE_NAMEONLY, "IME_ReadUserInfo", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_IsEmptyFont, HANDLE_NAMEONLY, "IME_IsEmptyFont", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_SetHandWrtConfig, HANDLE_NAMEONLY, "IME_SetHandWrtConfig", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_SetHandWrtStudyFlag, HANDLE_NAMEONLY, "IME_SetHandWrtStudyFlag", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_SetRecognizeFlag, HANDLE_NAMEONLY, "IME_SetRecognizeFlag", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_GetCtrl, HANDLE_NAMEONLY, "IME_GetCtrl", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_GetCtrlState, HANDLE_NAMEONLY, "IME_GetCtrlState", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_GetViewInfo, HANDLE_NAMEONLY, "IME_GetViewInfo", nullptr),
+	REGISTER_HANDLER(SDKLIB_SCcorrection, HANDLE_NAMEONLY, "SCcorrection", nullptr),
+	REGISTER_HANDLER(SDKLIB_SCwildcard, HANDLE_NAMEONLY, "SCwildcard", nullptr),
+	REGISTER_HANDLER(SDKLIB_SCverify, HANDLE_NAMEONLY, "SCverify", nullptr),
+	REGISTER_HANDLER(SDKLIB_InitialSpelling, HANDLE_NAMEONLY, "InitialSpelling", nullptr),
+	REGISTER_HANDLER(SDKLIB_SCopenDatabase, HANDLE_NAMEONLY, "SCopenDatabase", nullptr),
+	REGISTER_HANDLER(SDKLIB_SCcloseDatabase, HANDLE_NAMEONLY, "SCcloseDatabase", nullptr),
+	REGISTER_HANDLER(SDKLIB_SCGetMaxWordLen, HANDLE_NAMEONLY, "SCGetMaxWordLen", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetTotalItem, HANDLE_NAMEONLY, "GetTotalItem", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetMaxBlockSize, HANDLE_NAMEONLY, "GetMaxBlockSize", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetKeyWord, HANDLE_NAMEONLY, "GetKeyWord", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetAllContent, HANDLE_NAMEONLY, "GetAllContent", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetSaveAddress, HANDLE_NAMEONLY, "GetSaveAddress", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetAlpExit, HANDLE_NAMEONLY, "GetAlpExit", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetAlpExit, HANDLE_NAMEONLY, "SetAlpExit", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetDictFont, HANDLE_NAMEONLY, "SetDictFont", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetDictFont, HANDLE_NAMEONLY, "GetDictFont", nullptr),
+	REGISTER_HANDLER(SDKLIB_UniversalCrossSearch, HANDLE_NAMEONLY, "UniversalCrossSearch", nullptr),
+	REGISTER_HANDLER(SDKLIB_UniversalDictList, HANDLE_NAMEONLY, "UniversalDictList", nullptr),
+	REGISTER_HANDLER(SDKLIB_UniversalDictListForAll, HANDLE_NAMEONLY, "UniversalDictListForAll", nullptr),
+	REGISTER_HANDLER(SDKLIB_UniversalCardList, HANDLE_NAMEONLY, "UniversalCardList", nullptr),
+	REGISTER_HANDLER(SDKLIB_SearchEveryWay, HANDLE_NAMEONLY, "SearchEveryWay", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetAddDictPosInList, HANDLE_NAMEONLY, "GetAddDictPosInList", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetCurrentCardDictNum, HANDLE_NAMEONLY, "GetCurrentCardDictNum", nullptr),
+	REGISTER_HANDLER(SDKLIB_SearchCurrentCardDictInfo, HANDLE_NAMEONLY, "SearchCurrentCardDictInfo", nullptr),
+	REGISTER_HANDLER(SDKLIB_ReleaseCardDictInfo, HANDLE_NAMEONLY, "ReleaseCardDictInfo", nullptr),
+	REGISTER_HANDLER(SDKLIB_PRICHVIEW_SetBufferAttrib, HANDLE_NAMEONLY, "PRICHVIEW_SetBufferAttrib", nullptr),
+	REGISTER_HANDLER(SDKLIB_PRICHVIEW_SpeechForRich, HANDLE_NAMEONLY, "PRICHVIEW_SpeechForRich", nullptr),
+	REGISTER_HANDLER(SDKLIB_IsDictOuYu, HANDLE_NAMEONLY, "IsDictOuYu", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateRichView, HANDLE_NAMEONLY, "CreateRichView", nullptr),
+	REGISTER_HANDLER(SDKLIB_AddScrollBarToRichview, HANDLE_NAMEONLY, "AddScrollBarToRichview", nullptr),
+	REGISTER_HANDLER(SDKLIB_ChangeScrollBarToRichview, HANDLE_NAMEONLY, "ChangeScrollBarToRichview", nullptr),
+	REGISTER_HANDLER(SDKLIB_ChangeScrollBarPos, HANDLE_NAMEONLY, "ChangeScrollBarPos", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetDisplayMode, HANDLE_NAMEONLY, "SetDisplayMode", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetShowSearchLayer, HANDLE_NAMEONLY, "SetShowSearchLayer", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetWindowState, HANDLE_NAMEONLY, "SetWindowState", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetWindowState, HANDLE_NAMEONLY, "GetWindowState", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetBaseLine, HANDLE_NAMEONLY, "GetBaseLine", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetBaseLine, HANDLE_NAMEONLY, "SetBaseLine", nullptr),
+	REGISTER_HANDLER(SDKLIB_BackupWindowState, HANDLE_NAMEONLY, "BackupWindowState", nullptr),
+	REGISTER_HANDLER(SDKLIB_RestoreWindowState, HANDLE_NAMEONLY, "RestoreWindowState", nullptr),
+	REGISTER_HANDLER(SDKLIB_PRICHVIEW_draw, HANDLE_NAMEONLY, "PRICHVIEW_draw", nullptr),
+	REGISTER_HANDLER(SDKLIB_PRICHVIEW_handleEvent, HANDLE_NAMEONLY, "PRICHVIEW_handleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetMarkString, HANDLE_NAMEONLY, "GetMarkString", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetRichWindowState, HANDLE_NAMEONLY, "GetRichWindowState", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetShowMode, HANDLE_NAMEONLY, "SetShowMode", nullptr),
+	REGISTER_HANDLER(SDKLIB_PRICHVIEW_ShowSearchLayer, HANDLE_NAMEONLY, "PRICHVIEW_ShowSearchLayer", nullptr),
+	REGISTER_HANDLER(SDKLIB_PRICHVIEW_SetStateForUser, HANDLE_NAMEONLY, "PRICHVIEW_SetStateForUser", nullptr),
+	REGISTER_HANDLER(SDKLIB_PRICHVIEW_WriteString, HANDLE_NAMEONLY, "PRICHVIEW_WriteString", nullptr),
+	REGISTER_HANDLER(SDKLIB_RichViewSetColor, HANDLE_NAMEONLY, "RichViewSetColor", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetTotalLine, HANDLE_NAMEONLY, "SetTotalLine", nullptr),
+	REGISTER_HANDLER(SDKLIB_ShowRichContentOnly, HANDLE_NAMEONLY, "ShowRichContentOnly", nullptr),
+	REGISTER_HANDLER(SDKLIB_PRICHVIEW_SetCttsType, HANDLE_NAMEONLY, "PRICHVIEW_SetCttsType", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetDefLineEditorInfo, HANDLE_NAMEONLY, "SetDefLineEditorInfo", nullptr),
+	REGISTER_HANDLER(SDKLIB_LineEditor, HANDLE_NAMEONLY, "LineEditor", nullptr),
+	REGISTER_HANDLER(SDKLIB_LineEditor_handleEvent, HANDLE_NAMEONLY, "LineEditor_handleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_DictEditor_handleEvent, HANDLE_NAMEONLY, "DictEditor_handleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_LEModuleForUser, HANDLE_NAMEONLY, "LEModuleForUser", nullptr),
+	REGISTER_HANDLER(SDKLIB_LineEditor_ModuleForUser, HANDLE_NAMEONLY, "LineEditor_ModuleForUser", nullptr),
+	REGISTER_HANDLER(SDKLIB_LEDictWiseSearch, HANDLE_NAMEONLY, "LEDictWiseSearch", nullptr),
+	REGISTER_HANDLER(SDKLIB_IsWildCard, HANDLE_NAMEONLY, "IsWildCard", nullptr),
+	REGISTER_HANDLER(SDKLIB_LEditor_draw, HANDLE_NAMEONLY, "LEditor_draw", nullptr),
+	REGISTER_HANDLER(SDKLIB_LINEEDITOR_changeFocuseAct, HANDLE_NAMEONLY, "LINEEDITOR_changeFocuseAct", nullptr),
+	REGISTER_HANDLER(SDKLIB_LEDSK_handleEvent, HANDLE_NAMEONLY, "LEDSK_handleEvent", nullptr),
+	REGISTER_HANDLER(SDKLIB_LineEditorCompareStr, HANDLE_NAMEONLY, "LineEditorCompareStr", nullptr),
+	REGISTER_HANDLER(SDKLIB_LineEditorWiseSearch, HANDLE_NAMEONLY, "LineEditorWiseSearch", nullptr),
+	REGISTER_HANDLER(SDKLIB_SearchDict, HANDLE_NAMEONLY, "SearchDict", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetSearchDictShortName, HANDLE_NAMEONLY, "GetSearchDictShortName", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetCurrentMainDictNum, HANDLE_NAMEONLY, "GetCurrentMainDictNum", nullptr),
+	REGISTER_HANDLER(SDKLIB_PRICHVIEW_OKSpeechForRich, HANDLE_NAMEONLY, "PRICHVIEW_OKSpeechForRich", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetIndexHcaOffset, HANDLE_NAMEONLY, "GetIndexHcaOffset", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetIndexIconOffset, HANDLE_NAMEONLY, "GetIndexIconOffset", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetAppIndexIconOffset, HANDLE_NAMEONLY, "GetAppIndexIconOffset", nullptr),
+	REGISTER_HANDLER(SDKLIB_LoadHCAToGraphicByIdx, HANDLE_NAMEONLY, "LoadHCAToGraphicByIdx", nullptr),
+	REGISTER_HANDLER(SDKLIB_LoadHCAToGraphicHeadByIdx, HANDLE_NAMEONLY, "LoadHCAToGraphicHeadByIdx", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetIndexHCAHeight, HANDLE_NAMEONLY, "GetIndexHCAHeight", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetIndexHCAWidth, HANDLE_NAMEONLY, "GetIndexHCAWidth", nullptr),
+	REGISTER_HANDLER(SDKLIB_ShowHCAByOffset, HANDLE_NAMEONLY, "ShowHCAByOffset", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetHCATransparentMode, HANDLE_NAMEONLY, "SetHCATransparentMode", nullptr),
+	REGISTER_HANDLER(SDKLIB_ReleaseHcaCache, HANDLE_NAMEONLY, "ReleaseHcaCache", nullptr),
+	REGISTER_HANDLER(SDKLIB_ResetCache, HANDLE_NAMEONLY, "ResetCache", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetLibDataindexOffset, HANDLE_NAMEONLY, "SetLibDataindexOffset", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetLibAddrFromID, HANDLE_NAMEONLY, "GetLibAddrFromID", nullptr),
+	REGISTER_HANDLER(SDKLIB_ShowBookProFromFile, HANDLE_NAMEONLY, "ShowBookProFromFile", nullptr),
+	REGISTER_HANDLER(SDKLIB_RunBook, HANDLE_NAMEONLY, "RunBook", nullptr),
+	REGISTER_HANDLER(SDKLIB_ShowBook, HANDLE_NAMEONLY, "ShowBook", nullptr),
+	REGISTER_HANDLER(SDKLIB_ShowBookPreview, HANDLE_NAMEONLY, "ShowBookPreview", nullptr),
+	REGISTER_HANDLER(SDKLIB_ShowBookEx, HANDLE_NAMEONLY, "ShowBookEx", nullptr),
+	REGISTER_HANDLER(SDKLIB_USBMassStorageRun, HANDLE_NAMEONLY, "USBMassStorageRun", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetPassThroughCallBack, HANDLE_NAMEONLY, "SetPassThroughCallBack", nullptr),
+	REGISTER_HANDLER(SDKLIB_ctts_predict, HANDLE_NAMEONLY, "ctts_predict", nullptr),
+	REGISTER_HANDLER(SDKLIB_ctts_nounce, HANDLE_NAMEONLY, "ctts_nounce", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetAllVoiceState, HANDLE_NAMEONLY, "SetAllVoiceState", nullptr),
+	REGISTER_HANDLER(SDKLIB_OpenPCMCodec, HANDLE_NAMEONLY, "OpenPCMCodec", nullptr),
+	REGISTER_HANDLER(SDKLIB_ClosePCMCodec, HANDLE_NAMEONLY, "ClosePCMCodec", nullptr),
+	REGISTER_HANDLER(SDKLIB_AudioPlayBackPause, HANDLE_NAMEONLY, "AudioPlayBackPause", nullptr),
+	REGISTER_HANDLER(SDKLIB_AudioPlayBackContinue, HANDLE_NAMEONLY, "AudioPlayBackContinue", nullptr),
+	REGISTER_HANDLER(SDKLIB_PlayWaveData, HANDLE_NAMEONLY, "PlayWaveData", nullptr),
+	REGISTER_HANDLER(SDKLIB_StopWaveDataPlay, HANDLE_NAMEONLY, "StopWaveDataPlay", nullptr),
+	REGISTER_HANDLER(SDKLIB_PauseWaveDataPlay, HANDLE_NAMEONLY, "PauseWaveDataPlay", nullptr),
+	REGISTER_HANDLER(SDKLIB_ContinueWaveDataPlay, HANDLE_NAMEONLY, "ContinueWaveDataPlay", nullptr),
+	REGISTER_HANDLER(SDKLIB_RecordAdpcmEx, HANDLE_NAMEONLY, "RecordAdpcmEx", nullptr),
+	REGISTER_HANDLER(SDKLIB_StopADPCMRecord, HANDLE_NAMEONLY, "StopADPCMRecord", nullptr),
+	REGISTER_HANDLER(SDKLIB_IsWaveDataPlayStopped, HANDLE_NAMEONLY, "IsWaveDataPlayStopped", nullptr),
+	REGISTER_HANDLER(SDKLIB_PlayMP3Data, HANDLE_NAMEONLY, "PlayMP3Data", nullptr),
+	REGISTER_HANDLER(SDKLIB_StopMP3DataPlay, HANDLE_NAMEONLY, "StopMP3DataPlay", nullptr),
+	REGISTER_HANDLER(SDKLIB_PausePlayMP3Data, HANDLE_NAMEONLY, "PausePlayMP3Data", nullptr),
+	REGISTER_HANDLER(SDKLIB_ContinuePlayMP3Data, HANDLE_NAMEONLY, "ContinuePlayMP3Data", nullptr),
+	REGISTER_HANDLER(SDKLIB_InitBestlkHandle, HANDLE_NAMEONLY, "InitBestlkHandle", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetBestlkVoiceHandle, HANDLE_NAMEONLY, "SetBestlkVoiceHandle", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_RegistInputer, HANDLE_NAMEONLY, "IME_RegistInputer", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetLanguageAttr, HANDLE_NAMEONLY, "SetLanguageAttr", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetDialectAttr, HANDLE_NAMEONLY, "SetDialectAttr", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetLineEditorAttr, HANDLE_NAMEONLY, "SetLineEditorAttr", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetBookLibDataHFile, HANDLE_NAMEONLY, "SetBookLibDataHFile", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetBookVocLibDataHFile, HANDLE_NAMEONLY, "SetBookVocLibDataHFile", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_SetGlobalVar, HANDLE_NAMEONLY, "IME_SetGlobalVar", nullptr),
+	REGISTER_HANDLER(SDKLIB_IME_Functions, HANDLE_NAMEONLY, "IME_Functions", nullptr),
+	REGISTER_HANDLER(SDKLIB_LE_SupportMultiLangFunc, HANDLE_NAMEONLY, "LE_SupportMultiLangFunc", nullptr),
+	REGISTER_HANDLER(SDKLIB_ShowBookFromHANDLE, HANDLE_NAMEONLY, "ShowBookFromHANDLE", nullptr),
+	REGISTER_HANDLER(SDKLIB__wfnsplit, HANDLE_NAMEONLY, "_wfnsplit", nullptr),
+	REGISTER_HANDLER(SDKLIB__wfnmerge, HANDLE_NAMEONLY, "_wfnmerge", nullptr),
+	REGISTER_HANDLER(SDKLIB__wfcreate, HANDLE_NAMEONLY, "_wfcreate", nullptr),
+	REGISTER_HANDLER(SDKLIB__wfcreateSz, HANDLE_NAMEONLY, "_wfcreateSz", nullptr),
+	REGISTER_HANDLER(SDKLIB___wfopen, HANDLE_IMPLEMENTED, "__wfopen", __wfopen),
+	REGISTER_HANDLER(SDKLIB__wfindfirst, HANDLE_NAMEONLY, "_wfindfirst", _wfindfirst),
+	REGISTER_HANDLER(SDKLIB__wfindnext, HANDLE_NAMEONLY, "_wfindnext", _wfindnext),
+	REGISTER_HANDLER(SDKLIB__wfgetattr, HANDLE_NAMEONLY, "_wfgetattr", nullptr),
+	REGISTER_HANDLER(SDKLIB__wfsetattr, HANDLE_NAMEONLY, "_wfsetattr", nullptr),
+	REGISTER_HANDLER(SDKLIB___wremove, HANDLE_NAMEONLY, "__wremove", _wremove),
+	REGISTER_HANDLER(SDKLIB__wrename, HANDLE_NAMEONLY, "_wrename", nullptr),
+	REGISTER_HANDLER(SDKLIB__wfcopy, HANDLE_NAMEONLY, "_wfcopy", nullptr),
+	REGISTER_HANDLER(SDKLIB__wmkdir, HANDLE_NAMEONLY, "_wmkdir", _wmkdir),
+	REGISTER_HANDLER(SDKLIB__wrmdir, HANDLE_NAMEONLY, "_wrmdir", nullptr),
+	REGISTER_HANDLER(SDKLIB__wchdir, HANDLE_NAMEONLY, "_wchdir", _wchdir),
+	REGISTER_HANDLER(SDKLIB__wgetcurdir, HANDLE_NAMEONLY, "_wgetcurdir", nullptr),
+	REGISTER_HANDLER(SDKLIB__afsettime, HANDLE_NAMEONLY, "_afsettime", nullptr),
+	REGISTER_HANDLER(SDKLIB__wfsettime, HANDLE_NAMEONLY, "_wfsettime", nullptr),
+	REGISTER_HANDLER(SDKLIB__afullpath, HANDLE_NAMEONLY, "_afullpath", nullptr),
+	REGISTER_HANDLER(SDKLIB__wfullpath, HANDLE_NAMEONLY, "_wfullpath", nullptr),
+	REGISTER_HANDLER(SDKLIB_RunApplicationW, HANDLE_NAMEONLY, "RunApplicationW", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetApplicationNameW, HANDLE_NAMEONLY, "GetApplicationNameW", nullptr),
+	REGISTER_HANDLER(SDKLIB_LoadProgramW, HANDLE_NAMEONLY, "LoadProgramW", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetCurrentPathW, HANDLE_NAMEONLY, "GetCurrentPathW", nullptr),
+	REGISTER_HANDLER(SDKLIB_ProgramIsRunningW, HANDLE_NAMEONLY, "ProgramIsRunningW", nullptr),
+	REGISTER_HANDLER(SDKLIB_LoadHFileProgramW, HANDLE_NAMEONLY, "LoadHFileProgramW", nullptr),
+	REGISTER_HANDLER(SDKLIB_LoadHFileProgramA, HANDLE_NAMEONLY, "LoadHFileProgramA", nullptr),
+	REGISTER_HANDLER(SDKLIB__LoadLibraryA, HANDLE_IMPLEMENTED, "_LoadLibraryA", _LoadLibraryA),
+	REGISTER_HANDLER(SDKLIB__GetModuleFileNameA, HANDLE_NAMEONLY, "_GetModuleFileNameA", _GetModuleFileNameA),
+	REGISTER_HANDLER(SDKLIB__GetModuleHandleA, HANDLE_NAMEONLY, "_GetModuleHandleA", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetApplicationProcA, HANDLE_NAMEONLY, "GetApplicationProcA", nullptr),
+	REGISTER_HANDLER(SDKLIB_StayResidentProgramA, HANDLE_NAMEONLY, "StayResidentProgramA", nullptr),
+	REGISTER_HANDLER(SDKLIB_UnStayResidentProgramA, HANDLE_NAMEONLY, "UnStayResidentProgramA", nullptr),
+	REGISTER_HANDLER(SDKLIB_CheckProgramIsStayResident, HANDLE_NAMEONLY, "CheckProgramIsStayResident", nullptr),
+	REGISTER_HANDLER(SDKLIB__FindResourceA, HANDLE_NAMEONLY, "_FindResourceA", nullptr),
+	REGISTER_HANDLER(SDKLIB__FindResourceExA, HANDLE_NAMEONLY, "_FindResourceExA", nullptr),
+	REGISTER_HANDLER(SDKLIB__LoadLibraryW, HANDLE_NAMEONLY, "_LoadLibraryW", nullptr),
+	REGISTER_HANDLER(SDKLIB__GetModuleFileNameW, HANDLE_NAMEONLY, "_GetModuleFileNameW", nullptr),
+	REGISTER_HANDLER(SDKLIB__GetModuleHandleW, HANDLE_NAMEONLY, "_GetModuleHandleW", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetApplicationProcW, HANDLE_NAMEONLY, "GetApplicationProcW", nullptr),
+	REGISTER_HANDLER(SDKLIB__FindResourceW, HANDLE_IMPLEMENTED, "_FindResourceW", _FindResourceW),
+	REGISTER_HANDLER(SDKLIB__FindResourceExW, HANDLE_NAMEONLY, "_FindResourceExW", nullptr),
+	REGISTER_HANDLER(SDKLIB_StayResidentProgramW, HANDLE_NAMEONLY, "StayResidentProgramW", nullptr),
+	REGISTER_HANDLER(SDKLIB_UnStayResidentProgramW, HANDLE_NAMEONLY, "UnStayResidentProgramW", nullptr),
+	REGISTER_HANDLER(SDKLIB__FreeLibrary, HANDLE_IMPLEMENTED, "_FreeLibrary", _FreeLibrary),
+	REGISTER_HANDLER(SDKLIB__GetProcAddress, HANDLE_NAMEONLY, "_GetProcAddress", nullptr),
+	REGISTER_HANDLER(SDKLIB__SizeofResource, HANDLE_NAMEONLY, "_SizeofResource", nullptr),
+	REGISTER_HANDLER(SDKLIB__OpenResourceItemFile, HANDLE_NAMEONLY, "_OpenResourceItemFile", nullptr),
+	REGISTER_HANDLER(SDKLIB__CloseResourceItemFile, HANDLE_NAMEONLY, "_CloseResourceItemFile", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetCardSN, HANDLE_NAMEONLY, "GetCardSN", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetCardSize, HANDLE_NAMEONLY, "GetCardSize", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetThaiWord, HANDLE_NAMEONLY, "GetThaiWord", nullptr),
+	REGISTER_HANDLER(SDKLIB_LoadThaiGrammarLib, HANDLE_NAMEONLY, "LoadThaiGrammarLib", nullptr),
+	REGISTER_HANDLER(SDKLIB_FreeThaiGrammarLib, HANDLE_NAMEONLY, "FreeThaiGrammarLib", nullptr),
+	REGISTER_HANDLER(SDKLIB_WriteComDebugMsg, HANDLE_IMPLEMENTED, "WriteComDebugMsg", dbgMsg),
+	REGISTER_HANDLER(SDKLIB_CreateIconButton, HANDLE_NAMEONLY, "CreateIconButton", nullptr),
+	REGISTER_HANDLER(SDKLIB_LoadImageFile, HANDLE_NAMEONLY, "LoadImageFile", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetResourceCfg, HANDLE_NAMEONLY, "GetResourceCfg", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetSystemDefaultLangID, HANDLE_NAMEONLY, "GetSystemDefaultLangID", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetSystemDefaultLangID, HANDLE_NAMEONLY, "SetSystemDefaultLangID", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateFile, HANDLE_NAMEONLY, "CreateFile", Bind<&CreateFile>),
+	REGISTER_HANDLER(SDKLIB_DeleteFile, HANDLE_NAMEONLY, "DeleteFile", nullptr),
+	REGISTER_HANDLER(SDKLIB_ReadFile, HANDLE_NAMEONLY, "ReadFile", nullptr),
+	REGISTER_HANDLER(SDKLIB_WriteFile, HANDLE_NAMEONLY, "WriteFile", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetFilePointer, HANDLE_NAMEONLY, "SetFilePointer", nullptr),
+	REGISTER_HANDLER(SDKLIB_DeviceIoControl, HANDLE_NAMEONLY, "DeviceIoControl", Bind<&DeviceIoControl>),
+	REGISTER_HANDLER(SDKLIB_CloseHandle, HANDLE_NAMEONLY, "CloseHandle", Bind<&CloseHandle>),
+	REGISTER_HANDLER(SDKLIB_DictLastWord, HANDLE_NAMEONLY, "DictLastWord", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetTransBuffer, HANDLE_NAMEONLY, "GetTransBuffer", nullptr),
+	REGISTER_HANDLER(SDKLIB_DictIsYuanYinPhonetic, HANDLE_NAMEONLY, "DictIsYuanYinPhonetic", nullptr),
+	REGISTER_HANDLER(SDKLIB_InsertButtonTeam, HANDLE_NAMEONLY, "InsertButtonTeam", nullptr),
+	REGISTER_HANDLER(SDKLIB_CreateSearchInfo, HANDLE_NAMEONLY, "CreateSearchInfo", nullptr),
+	REGISTER_HANDLER(SDKLIB_FreeSearchInfo, HANDLE_NAMEONLY, "FreeSearchInfo", nullptr),
+	REGISTER_HANDLER(SDKLIB_DefProcessContent, HANDLE_NAMEONLY, "DefProcessContent", nullptr),
+	REGISTER_HANDLER(SDKLIB_DefInsertPic, HANDLE_NAMEONLY, "DefInsertPic", nullptr),
+	REGISTER_HANDLER(SDKLIB_DefGetWholeWord, HANDLE_NAMEONLY, "DefGetWholeWord", nullptr),
+	REGISTER_HANDLER(SDKLIB_DefAddALine, HANDLE_NAMEONLY, "DefAddALine", nullptr),
+	REGISTER_HANDLER(SDKLIB_PRICHVIEW_GetFlagLength, HANDLE_NAMEONLY, "PRICHVIEW_GetFlagLength", nullptr),
+	REGISTER_HANDLER(SDKLIB_PRICHVIEW_FilterMark, HANDLE_NAMEONLY, "PRICHVIEW_FilterMark", nullptr),
+	REGISTER_HANDLER(SDKLIB_AddNewWord, HANDLE_NAMEONLY, "AddNewWord", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetMaxSearchLayer, HANDLE_NAMEONLY, "GetMaxSearchLayer", nullptr),
+	REGISTER_HANDLER(SDKLIB_FormatMessage, HANDLE_NAMEONLY, "FormatMessage", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetFont, HANDLE_NAMEONLY, "SetFont", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetFont, HANDLE_NAMEONLY, "GetFont", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetFontWidth, HANDLE_NAMEONLY, "GetFontWidth", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetStringLengthEx, HANDLE_NAMEONLY, "GetStringLengthEx", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetFontStyle, HANDLE_NAMEONLY, "SetFontStyle", nullptr),
+	REGISTER_HANDLER(SDKLIB_RegisterUserFont, HANDLE_NAMEONLY, "RegisterUserFont", nullptr),
+	REGISTER_HANDLER(SDKLIB_UnRegisterUserFont, HANDLE_NAMEONLY, "UnRegisterUserFont", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetCurrentVideoDevice, HANDLE_NAMEONLY, "SetCurrentVideoDevice", nullptr),
+	REGISTER_HANDLER(SDKLIB_SetSupportDoubleLCD, HANDLE_NAMEONLY, "SetSupportDoubleLCD", nullptr),
+	REGISTER_HANDLER(SDKLIB__GetDriverType, HANDLE_NAMEONLY, "_GetDriverType", nullptr),
+	REGISTER_HANDLER(SDKLIB_EditControlFunc, HANDLE_NAMEONLY, "EditControlFunc", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetMasterSerialNumber, HANDLE_NAMEONLY, "GetMasterSerialNumber", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetMasterVendorInfo, HANDLE_NAMEONLY, "GetMasterVendorInfo", nullptr),
+	REGISTER_HANDLER(SDKLIB_PRICHVIEW_SetDisplayPosition, HANDLE_NAMEONLY, "PRICHVIEW_SetDisplayPosition", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetApplicationHeadInfoA, HANDLE_NAMEONLY, "GetApplicationHeadInfoA", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetApplicationHeadInfoW, HANDLE_NAMEONLY, "GetApplicationHeadInfoW", nullptr),
+	REGISTER_HANDLER(SDKLIB__FreeFindResInfo, HANDLE_NAMEONLY, "_FreeFindResInfo", nullptr),
+	REGISTER_HANDLER(SDKLIB_GetWholeWord, HANDLE_NAMEONLY, "GetWholeWord", nullptr),
+	REGISTER_HANDLER(SDKLIB_LoadWordGrammarLib, HANDLE_NAMEONLY, "LoadWordGrammarLib", nullptr),
+	REGISTER_HANDLER(SDKLIB_FreeWordGrammarLib, HANDLE_NAMEONLY, "FreeWordGrammarLib", nullptr),
+	REGISTER_HANDLER(SDKLIB_mount_file_disk, HANDLE_NAMEONLY, "mount_file_disk", nullptr),
+	REGISTER_HANDLER(SDKLIB_umount_file_disk, HANDLE_NAMEONLY, "umount_file_disk", nullptr),
+	REGISTER_HANDLER(SDKLIB___close, HANDLE_NAMEONLY, "__close", nullptr),
+	REGISTER_HANDLER(SDKLIB___commit, HANDLE_NAMEONLY, "__commit", nullptr),
+	REGISTER_HANDLER(SDKLIB___creat, HANDLE_NAMEONLY, "__creat", nullptr),
+	REGISTER_HANDLER(SDKLIB___dup, HANDLE_NAMEONLY, "__dup", nullptr),
+	REGISTER_HANDLER(SDKLIB___wcreat, HANDLE_NAMEONLY, "__wcreat", nullptr),
+	REGISTER_HANDLER(SDKLIB___eof, HANDLE_NAMEONLY, "__eof", nullptr),
+	REGISTER_HANDLER(SDKLIB___get_errno, HANDLE_NAMEONLY, "__get_errno", nullptr),
+	REGISTER_HANDLER(SDKLIB___lseek, HANDLE_NAMEONLY, "__lseek", nullptr),
+	REGISTER_HANDLER(SDKLIB___lseeki64, HANDLE_NAMEONLY, "__lseeki64", nullptr),
+	REGISTER_HANDLER(SDKLIB___open, HANDLE_NAMEONLY, "__open", nullptr),
+	REGISTER_HANDLER(SDKLIB___wopen, HANDLE_NAMEONLY, "__wopen", nullptr),
+	REGISTER_HANDLER(SDKLIB___read, HANDLE_NAMEONLY, "__read", nullptr),
+	REGISTER_HANDLER(SDKLIB___set_errno, HANDLE_NAMEONLY, "__set_errno", nullptr),
+	REGISTER_HANDLER(SDKLIB___tell, HANDLE_NAMEONLY, "__tell", nullptr),
+	REGISTER_HANDLER(SDKLIB___telli64, HANDLE_NAMEONLY, "__telli64", nullptr),
+	REGISTER_HANDLER(SDKLIB___truncate, HANDLE_NAMEONLY, "__truncate", nullptr),
+	REGISTER_HANDLER(SDKLIB___write, HANDLE_NAMEONLY, "__write", nullptr),
+	REGISTER_HANDLER(SDKLIB__MultiByteToWideChar, HANDLE_NAMEONLY, "_MultiByteToWideChar", nullptr),
+	REGISTER_HANDLER(SDKLIB__WideCharToMultiByte, HANDLE_NAMEONLY, "_WideCharToMultiByte", nullptr),
+};
+
+static constexpr bool IsDenseHandlerTable()
 {
-	REGISTER_HANDLER(SDKLIB_OSCreateThread, HANDLE_IMPLEMENTED, "OSCreateThread", OSCreateThread);
-	REGISTER_HANDLER(SDKLIB_OSTerminateThread, HANDLE_NAMEONLY, "OSTerminateThread", nullptr);
-	REGISTER_HANDLER(SDKLIB_OSSetThreadPriority, HANDLE_IMPLEMENTED, "OSSetThreadPriority", OSSetThreadPriority);
-	REGISTER_HANDLER(SDKLIB_OSGetThreadPriority, HANDLE_NAMEONLY, "OSGetThreadPriority", nullptr);
-	REGISTER_HANDLER(SDKLIB_OSSuspendThread, HANDLE_NAMEONLY, "OSSuspendThread", OSSuspendThread);
-	REGISTER_HANDLER(SDKLIB_OSResumeThread, HANDLE_NAMEONLY, "OSResumeThread", OSResumeThread);
-	REGISTER_HANDLER(SDKLIB_OSWakeUpThread, HANDLE_NAMEONLY, "OSWakeUpThread", nullptr);
-	REGISTER_HANDLER(SDKLIB_OSExitThread, HANDLE_NAMEONLY, "OSExitThread", nullptr);
-	REGISTER_HANDLER(SDKLIB_OSSleep, HANDLE_IMPLEMENTED, "OSSleep", OSSleep);
-	REGISTER_HANDLER(SDKLIB_OSCreateSemaphore, HANDLE_NAMEONLY, "OSCreateSemaphore", nullptr);
-	REGISTER_HANDLER(SDKLIB_OSWaitForSemaphore, HANDLE_NAMEONLY, "OSWaitForSemaphore", nullptr);
-	REGISTER_HANDLER(SDKLIB_OSReleaseSemaphore, HANDLE_NAMEONLY, "OSReleaseSemaphore", nullptr);
-	REGISTER_HANDLER(SDKLIB_OSCloseSemaphore, HANDLE_NAMEONLY, "OSCloseSemaphore", nullptr);
-	REGISTER_HANDLER(SDKLIB_OSCreateEvent, HANDLE_IMPLEMENTED, "OSCreateEvent", OSCreateEvent);
-	REGISTER_HANDLER(SDKLIB_OSWaitForEvent, HANDLE_NAMEONLY, "OSWaitForEvent", OSWaitForEvent);
-	REGISTER_HANDLER(SDKLIB_OSSetEvent, HANDLE_IMPLEMENTED, "OSSetEvent", OSSetEvent);
-	REGISTER_HANDLER(SDKLIB_OSResetEvent, HANDLE_NAMEONLY, "OSResetEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_OSCloseEvent, HANDLE_NAMEONLY, "OSCloseEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_OSInitCriticalSection, HANDLE_IMPLEMENTED, "OSInitCriticalSection", OSInitCriticalSection);
-	REGISTER_HANDLER(SDKLIB_OSEnterCriticalSection, HANDLE_IMPLEMENTED, "OSEnterCriticalSection", OSEnterCriticalSection);
-	REGISTER_HANDLER(SDKLIB_OSLeaveCriticalSection, HANDLE_IMPLEMENTED, "OSLeaveCriticalSection", OSLeaveCriticalSection);
-	REGISTER_HANDLER(SDKLIB_OSDeleteCriticalSection, HANDLE_NAMEONLY, "OSDeleteCriticalSection", nullptr);
-	REGISTER_HANDLER(SDKLIB_OSSetLastError, HANDLE_NAMEONLY, "OSSetLastError", nullptr);
-	REGISTER_HANDLER(SDKLIB_OSGetLastError, HANDLE_NAMEONLY, "OSGetLastError", nullptr);
-	REGISTER_HANDLER(SDKLIB_OSCreateMsgQue, HANDLE_NAMEONLY, "OSCreateMsgQue", nullptr);
-	REGISTER_HANDLER(SDKLIB_OSPostMsgQue, HANDLE_NAMEONLY, "OSPostMsgQue", nullptr);
-	REGISTER_HANDLER(SDKLIB_OSSendMsgQue, HANDLE_NAMEONLY, "OSSendMsgQue", nullptr);
-	REGISTER_HANDLER(SDKLIB_OSPeekMsgQue, HANDLE_NAMEONLY, "OSPeekMsgQue", nullptr);
-	REGISTER_HANDLER(SDKLIB_OSGetMsgQue, HANDLE_NAMEONLY, "OSGetMsgQue", nullptr);
-	REGISTER_HANDLER(SDKLIB_OSCloseMsgQue, HANDLE_NAMEONLY, "OSCloseMsgQue", nullptr);
-	REGISTER_HANDLER(SDKLIB_InterruptInitialize, HANDLE_NAMEONLY, "InterruptInitialize", InterruptInitialize);
-	REGISTER_HANDLER(SDKLIB_InterruptEnable, HANDLE_NAMEONLY, "InterruptEnable", nullptr);
-	REGISTER_HANDLER(SDKLIB_InterruptDisable, HANDLE_NAMEONLY, "InterruptDisable", nullptr);
-	REGISTER_HANDLER(SDKLIB_InterruptDone, HANDLE_NAMEONLY, "InterruptDone", InterruptDone);
-	REGISTER_HANDLER(SDKLIB_InterruptSetMode, HANDLE_NAMEONLY, "InterruptSetMode", nullptr);
-	REGISTER_HANDLER(SDKLIB_DisableAutoSync, HANDLE_NAMEONLY, "DisableAutoSync", nullptr);
-	REGISTER_HANDLER(SDKLIB_EnableAutoSync, HANDLE_NAMEONLY, "EnableAutoSync", nullptr);
-	REGISTER_HANDLER(SDKLIB_getvect, HANDLE_NAMEONLY, "getvect", nullptr);
-	REGISTER_HANDLER(SDKLIB_setvect, HANDLE_NAMEONLY, "setvect", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetLCDContrast, HANDLE_NAMEONLY, "GetLCDContrast", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetLCDContrast, HANDLE_NAMEONLY, "SetLCDContrast", nullptr);
-	REGISTER_HANDLER(SDKLIB_LCDOn, HANDLE_IMPLEMENTED, "LCDOn", LCDOn);
-	REGISTER_HANDLER(SDKLIB_LCDOff, HANDLE_NAMEONLY, "LCDOff", nullptr);
-	REGISTER_HANDLER(SDKLIB_CheckLCDOn, HANDLE_NAMEONLY, "CheckLCDOn", nullptr);
-	REGISTER_HANDLER(SDKLIB_Buzzer, HANDLE_NAMEONLY, "Buzzer", nullptr);
-	REGISTER_HANDLER(SDKLIB_KeyBeep, HANDLE_NAMEONLY, "KeyBeep", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetTimer1IntHandler, HANDLE_NAMEONLY, "SetTimer1IntHandler", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetAutoPowerOff, HANDLE_NAMEONLY, "SetAutoPowerOff", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetTimer1IntHandler, HANDLE_NAMEONLY, "GetTimer1IntHandler", nullptr);
-	REGISTER_HANDLER(SDKLIB_RemapMemory, HANDLE_NAMEONLY, "RemapMemory", nullptr);
-	REGISTER_HANDLER(SDKLIB_SysPowerOff, HANDLE_NAMEONLY, "SysPowerOff", SysPowerOff);
-	REGISTER_HANDLER(SDKLIB_SetSysKeyState, HANDLE_NAMEONLY, "SetSysKeyState", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetSysKeyState, HANDLE_NAMEONLY, "GetSysKeyState", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetBatteryType, HANDLE_NAMEONLY, "GetBatteryType", nullptr);
-	REGISTER_HANDLER(SDKLIB_BatteryLowCheck, HANDLE_NAMEONLY, "BatteryLowCheck", BatteryLowCheck);
-	REGISTER_HANDLER(SDKLIB_lmalloc, HANDLE_IMPLEMENTED, "lmalloc", lmalloc);
-	REGISTER_HANDLER(SDKLIB_lcalloc, HANDLE_IMPLEMENTED, "lcalloc", lcalloc);
-	REGISTER_HANDLER(SDKLIB_lrealloc, HANDLE_IMPLEMENTED, "lrealloc", lrealloc);
-	REGISTER_HANDLER(SDKLIB__lfree, HANDLE_IMPLEMENTED, "_lfree", _lfree);
-	REGISTER_HANDLER(SDKLIB_GetPenEvent, HANDLE_NAMEONLY, "GetPenEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_CheckPenEvent, HANDLE_NAMEONLY, "CheckPenEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_ClearPenEvent, HANDLE_NAMEONLY, "ClearPenEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_PutSystemEvent, HANDLE_NAMEONLY, "PutSystemEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetEvent, HANDLE_NAMEONLY, "GetEvent", GetEvent);
-	REGISTER_HANDLER(SDKLIB_GetPendEvent, HANDLE_NAMEONLY, "GetPendEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetEventType, HANDLE_NAMEONLY, "SetEventType", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetEventType, HANDLE_NAMEONLY, "GetEventType", nullptr);
-	REGISTER_HANDLER(SDKLIB_PutEvent, HANDLE_NAMEONLY, "PutEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_PutEventExt, HANDLE_NAMEONLY, "PutEventExt", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetLastEvent, HANDLE_NAMEONLY, "GetLastEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_TestPendEvent, HANDLE_NAMEONLY, "TestPendEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_ClearPendEvent, HANDLE_NAMEONLY, "ClearPendEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_ClearPenState, HANDLE_NAMEONLY, "ClearPenState", nullptr);
-	REGISTER_HANDLER(SDKLIB_ClearEvent, HANDLE_NAMEONLY, "ClearEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_ClearAllEvents, HANDLE_NAMEONLY, "ClearAllEvents", nullptr);
-	REGISTER_HANDLER(SDKLIB_TestKeyEvent, HANDLE_NAMEONLY, "TestKeyEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetSystemVariable, HANDLE_NAMEONLY, "SetSystemVariable", SetSystemVariable);
-	REGISTER_HANDLER(SDKLIB_GetCharWidth, HANDLE_NAMEONLY, "GetCharWidth", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetFontHeight, HANDLE_NAMEONLY, "GetFontHeight", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetFontType, HANDLE_NAMEONLY, "GetFontType", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetStringLength, HANDLE_NAMEONLY, "GetStringLength", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetFontType, HANDLE_NAMEONLY, "SetFontType", nullptr);
-	REGISTER_HANDLER(SDKLIB_WriteAlignString, HANDLE_NAMEONLY, "WriteAlignString", nullptr);
-	REGISTER_HANDLER(SDKLIB_WriteChar, HANDLE_NAMEONLY, "WriteChar", nullptr);
-	REGISTER_HANDLER(SDKLIB_WriteString, HANDLE_NAMEONLY, "WriteString", nullptr);
-	REGISTER_HANDLER(SDKLIB_WriteStringInWindow, HANDLE_NAMEONLY, "WriteStringInWindow", nullptr);
-	REGISTER_HANDLER(SDKLIB_WriteStringInWindowEx, HANDLE_NAMEONLY, "WriteStringInWindowEx", nullptr);
-	REGISTER_HANDLER(SDKLIB_Printf, HANDLE_NAMEONLY, "Printf", nullptr);
-	REGISTER_HANDLER(SDKLIB_PrintfXY, HANDLE_NAMEONLY, "PrintfXY", nullptr);
-	REGISTER_HANDLER(SDKLIB_ShowGraphic, HANDLE_NAMEONLY, "ShowGraphic", nullptr);
-	REGISTER_HANDLER(SDKLIB_SizeofGraphic, HANDLE_NAMEONLY, "SizeofGraphic", nullptr);
-	REGISTER_HANDLER(SDKLIB_InitGraphic, HANDLE_NAMEONLY, "InitGraphic", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateIcon, HANDLE_NAMEONLY, "CreateIcon", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetCursorSize, HANDLE_NAMEONLY, "SetCursorSize", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetCursorSize, HANDLE_NAMEONLY, "GetCursorSize", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetCursorPosition, HANDLE_NAMEONLY, "SetCursorPosition", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetCursorPosition, HANDLE_NAMEONLY, "GetCursorPosition", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetCursorType, HANDLE_NAMEONLY, "SetCursorType", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetCursorType, HANDLE_NAMEONLY, "GetCursorType", nullptr);
-	REGISTER_HANDLER(SDKLIB_CursorLock, HANDLE_NAMEONLY, "CursorLock", nullptr);
-	REGISTER_HANDLER(SDKLIB_CursorUnlock, HANDLE_NAMEONLY, "CursorUnlock", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetTransparentColor, HANDLE_NAMEONLY, "SetTransparentColor", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetTransparentColor, HANDLE_NAMEONLY, "GetTransparentColor", nullptr);
-	REGISTER_HANDLER(SDKLIB_rgbSetBkColor, HANDLE_NAMEONLY, "rgbSetBkColor", nullptr);
-	REGISTER_HANDLER(SDKLIB_rgbSetColor, HANDLE_NAMEONLY, "rgbSetColor", nullptr);
-	REGISTER_HANDLER(SDKLIB_rgbGetBkColor, HANDLE_NAMEONLY, "rgbGetBkColor", nullptr);
-	REGISTER_HANDLER(SDKLIB_rgbGetColor, HANDLE_NAMEONLY, "rgbGetColor", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetPenStyle, HANDLE_NAMEONLY, "SetPenStyle", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetPenStyle, HANDLE_NAMEONLY, "GetPenStyle", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetPenSize, HANDLE_NAMEONLY, "GetPenSize", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetPenSize, HANDLE_NAMEONLY, "SetPenSize", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetPixel, HANDLE_NAMEONLY, "GetPixel", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetPixel, HANDLE_NAMEONLY, "SetPixel", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetImage, HANDLE_NAMEONLY, "GetImage", nullptr);
-	REGISTER_HANDLER(SDKLIB_PutImage, HANDLE_NAMEONLY, "PutImage", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetDrawArea, HANDLE_NAMEONLY, "SetDrawArea", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetDrawArea, HANDLE_NAMEONLY, "GetDrawArea", nullptr);
-	REGISTER_HANDLER(SDKLIB_DrawLine, HANDLE_NAMEONLY, "DrawLine", nullptr);
-	REGISTER_HANDLER(SDKLIB_DrawRect, HANDLE_NAMEONLY, "DrawRect", nullptr);
-	REGISTER_HANDLER(SDKLIB_FillRect, HANDLE_NAMEONLY, "FillRect", nullptr);
-	REGISTER_HANDLER(SDKLIB_DrawRoundRect, HANDLE_NAMEONLY, "DrawRoundRect", nullptr);
-	REGISTER_HANDLER(SDKLIB_DrawCircle, HANDLE_NAMEONLY, "DrawCircle", nullptr);
-	REGISTER_HANDLER(SDKLIB_FillCircle, HANDLE_NAMEONLY, "FillCircle", nullptr);
-	REGISTER_HANDLER(SDKLIB_DrawEllipse, HANDLE_NAMEONLY, "DrawEllipse", nullptr);
-	REGISTER_HANDLER(SDKLIB_FillEllipse, HANDLE_NAMEONLY, "FillEllipse", nullptr);
-	REGISTER_HANDLER(SDKLIB_InverseSetArea, HANDLE_NAMEONLY, "InverseSetArea", nullptr);
-	REGISTER_HANDLER(SDKLIB_ClearScreen, HANDLE_NAMEONLY, "ClearScreen", nullptr);
-	REGISTER_HANDLER(SDKLIB_ClearSetArea, HANDLE_NAMEONLY, "ClearSetArea", nullptr);
-	REGISTER_HANDLER(SDKLIB_ScrollDown, HANDLE_NAMEONLY, "ScrollDown", nullptr);
-	REGISTER_HANDLER(SDKLIB_ScrollLeft, HANDLE_NAMEONLY, "ScrollLeft", nullptr);
-	REGISTER_HANDLER(SDKLIB_ScrollRight, HANDLE_NAMEONLY, "ScrollRight", nullptr);
-	REGISTER_HANDLER(SDKLIB_ScrollUp, HANDLE_NAMEONLY, "ScrollUp", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetRealLCD, HANDLE_NAMEONLY, "GetRealLCD", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetToRealLCD, HANDLE_NAMEONLY, "SetToRealLCD", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetToVirtualLCD, HANDLE_NAMEONLY, "SetToVirtualLCD", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateVirtualLCD, HANDLE_NAMEONLY, "CreateVirtualLCD", nullptr);
-	REGISTER_HANDLER(SDKLIB_DeleteVirtualLCD, HANDLE_NAMEONLY, "DeleteVirtualLCD", nullptr);
-	REGISTER_HANDLER(SDKLIB__BitBlt, HANDLE_NAMEONLY, "_BitBlt", nullptr);
-	REGISTER_HANDLER(SDKLIB___fillrect, HANDLE_NAMEONLY, "__fillrect", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetActiveLCD, HANDLE_NAMEONLY, "SetActiveLCD", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetRealLCD, HANDLE_NAMEONLY, "SetRealLCD", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetActiveLCD, HANDLE_IMPLEMENTED, "GetActiveLCD", GetActiveLCD);
-	REGISTER_HANDLER(SDKLIB_CreateCompatibleLCD, HANDLE_NAMEONLY, "CreateCompatibleLCD", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateCompatibleImage, HANDLE_NAMEONLY, "CreateCompatibleImage", nullptr);
-	REGISTER_HANDLER(SDKLIB_DeleteLCD, HANDLE_NAMEONLY, "DeleteLCD", nullptr);
-	REGISTER_HANDLER(SDKLIB_SelectLCDObject, HANDLE_NAMEONLY, "SelectLCDObject", nullptr);
-	REGISTER_HANDLER(SDKLIB_DeleteLCDObject, HANDLE_NAMEONLY, "DeleteLCDObject", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetDCObject, HANDLE_NAMEONLY, "SetDCObject", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetWindowSize, HANDLE_NAMEONLY, "GetWindowSize", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetImageSize, HANDLE_NAMEONLY, "GetImageSize", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetImageSizeExt, HANDLE_NAMEONLY, "GetImageSizeExt", nullptr);
-	REGISTER_HANDLER(SDKLIB_ImageData, HANDLE_NAMEONLY, "ImageData", nullptr);
-	REGISTER_HANDLER(SDKLIB_SizeofImage, HANDLE_NAMEONLY, "SizeofImage", nullptr);
-	REGISTER_HANDLER(SDKLIB_FreeImage, HANDLE_NAMEONLY, "FreeImage", nullptr);
-	REGISTER_HANDLER(SDKLIB_Delay, HANDLE_NAMEONLY, "Delay", nullptr);
-	REGISTER_HANDLER(SDKLIB_PenDelay, HANDLE_NAMEONLY, "PenDelay", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetPenSilenceArea, HANDLE_NAMEONLY, "GetPenSilenceArea", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetPenSilenceArea, HANDLE_NAMEONLY, "SetPenSilenceArea", nullptr);
-	REGISTER_HANDLER(SDKLIB_WarningBeep, HANDLE_NAMEONLY, "WarningBeep", nullptr);
-	REGISTER_HANDLER(SDKLIB_LockSystem, HANDLE_NAMEONLY, "LockSystem", nullptr);
-	REGISTER_HANDLER(SDKLIB_UnlockSystem, HANDLE_NAMEONLY, "UnlockSystem", nullptr);
-	REGISTER_HANDLER(SDKLIB_CopyToClipBoard, HANDLE_NAMEONLY, "CopyToClipBoard", nullptr);
-	REGISTER_HANDLER(SDKLIB_CopyFromClipBoard, HANDLE_NAMEONLY, "CopyFromClipBoard", nullptr);
-	REGISTER_HANDLER(SDKLIB_ClearClipBoard, HANDLE_NAMEONLY, "ClearClipBoard", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetClipBoardTextLength, HANDLE_NAMEONLY, "GetClipBoardTextLength", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetSysTime, HANDLE_IMPLEMENTED, "GetSysTime", GetSysTime);
-	REGISTER_HANDLER(SDKLIB_SetSysTime, HANDLE_NAMEONLY, "SetSysTime", nullptr);
-	REGISTER_HANDLER(SDKLIB_PopupWaitingMsg, HANDLE_NAMEONLY, "PopupWaitingMsg", nullptr);
-	REGISTER_HANDLER(SDKLIB_CloseWaitingMsg, HANDLE_NAMEONLY, "CloseWaitingMsg", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetLanguageType, HANDLE_NAMEONLY, "GetLanguageType", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetLanguageType, HANDLE_NAMEONLY, "SetLanguageType", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetChineseFont, HANDLE_NAMEONLY, "SetChineseFont", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetChineseFont, HANDLE_NAMEONLY, "GetChineseFont", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetShiftState, HANDLE_NAMEONLY, "SetShiftState", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetCapsState, HANDLE_NAMEONLY, "SetCapsState", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetShiftState, HANDLE_NAMEONLY, "GetShiftState", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetCapsState, HANDLE_NAMEONLY, "GetCapsState", nullptr);
-	REGISTER_HANDLER(SDKLIB_Tradional2Simple, HANDLE_NAMEONLY, "Tradional2Simple", nullptr);
-	REGISTER_HANDLER(SDKLIB_Simple2Tradional, HANDLE_NAMEONLY, "Simple2Tradional", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetEPTSLastChar, HANDLE_NAMEONLY, "SetEPTSLastChar", nullptr);
-	REGISTER_HANDLER(SDKLIB_PlayAllVoice, HANDLE_NAMEONLY, "PlayAllVoice", nullptr);
-	REGISTER_HANDLER(SDKLIB_StopAllVoice, HANDLE_NAMEONLY, "StopAllVoice", nullptr);
-	REGISTER_HANDLER(SDKLIB_PauseAllVoice, HANDLE_NAMEONLY, "PauseAllVoice", nullptr);
-	REGISTER_HANDLER(SDKLIB_ContinueAllVoice, HANDLE_NAMEONLY, "ContinueAllVoice", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetAllVoiceState, HANDLE_NAMEONLY, "GetAllVoiceState", nullptr);
-	REGISTER_HANDLER(SDKLIB_RecordVoiceEx, HANDLE_NAMEONLY, "RecordVoiceEx", nullptr);
-	REGISTER_HANDLER(SDKLIB_PlaybackVoiceEx, HANDLE_NAMEONLY, "PlaybackVoiceEx", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetAudioHandler, HANDLE_NAMEONLY, "SetAudioHandler", nullptr);
-	REGISTER_HANDLER(SDKLIB_ConvCharToUnicode, HANDLE_NAMEONLY, "ConvCharToUnicode", nullptr);
-	REGISTER_HANDLER(SDKLIB_ConvStrToUnicode, HANDLE_NAMEONLY, "ConvStrToUnicode", nullptr);
-	REGISTER_HANDLER(SDKLIB_CompSecretkey, HANDLE_NAMEONLY, "CompSecretkey", nullptr);
-	REGISTER_HANDLER(SDKLIB_ClearSecretkey, HANDLE_NAMEONLY, "ClearSecretkey", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetUserFontHandle, HANDLE_NAMEONLY, "SetUserFontHandle", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetMasterIDInfo, HANDLE_NAMEONLY, "GetMasterIDInfo", GetMasterIDInfo);
-	REGISTER_HANDLER(SDKLIB_ReadFollowMe, HANDLE_NAMEONLY, "ReadFollowMe", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetPrivateState, HANDLE_NAMEONLY, "GetPrivateState", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetPrivateState, HANDLE_NAMEONLY, "SetPrivateState", nullptr);
-	REGISTER_HANDLER(SDKLIB__afnsplit, HANDLE_NAMEONLY, "_afnsplit", nullptr);
-	REGISTER_HANDLER(SDKLIB__afnmerge, HANDLE_NAMEONLY, "_afnmerge", nullptr);
-	REGISTER_HANDLER(SDKLIB__afcreate, HANDLE_NAMEONLY, "_afcreate", nullptr);
-	REGISTER_HANDLER(SDKLIB__afcreateSz, HANDLE_NAMEONLY, "_afcreateSz", nullptr);
-	REGISTER_HANDLER(SDKLIB__afopen, HANDLE_NAMEONLY, "_afopen", nullptr);
-	REGISTER_HANDLER(SDKLIB__fclose, HANDLE_IMPLEMENTED, "_fclose", _fclose);
-	REGISTER_HANDLER(SDKLIB__filesize, HANDLE_NAMEONLY, "_filesize", _filesize);
-	REGISTER_HANDLER(SDKLIB___fflush, HANDLE_NAMEONLY, "__fflush", nullptr);
-	REGISTER_HANDLER(SDKLIB__fflushall, HANDLE_NAMEONLY, "_fflushall", nullptr);
-	REGISTER_HANDLER(SDKLIB__rewind, HANDLE_NAMEONLY, "_rewind", nullptr);
-	REGISTER_HANDLER(SDKLIB___fseek, HANDLE_NAMEONLY, "__fseek", nullptr);
-	REGISTER_HANDLER(SDKLIB__ftell, HANDLE_NAMEONLY, "_ftell", nullptr);
-	REGISTER_HANDLER(SDKLIB__feof, HANDLE_NAMEONLY, "_feof", nullptr);
-	REGISTER_HANDLER(SDKLIB__fgetc, HANDLE_NAMEONLY, "_fgetc", nullptr);
-	REGISTER_HANDLER(SDKLIB__fgets, HANDLE_NAMEONLY, "_fgets", nullptr);
-	REGISTER_HANDLER(SDKLIB__fread, HANDLE_NAMEONLY, "_fread", _fread);
-	REGISTER_HANDLER(SDKLIB__fputc, HANDLE_NAMEONLY, "_fputc", nullptr);
-	REGISTER_HANDLER(SDKLIB__fputs, HANDLE_NAMEONLY, "_fputs", nullptr);
-	REGISTER_HANDLER(SDKLIB__fwrite, HANDLE_IMPLEMENTED, "_fwrite", _fwrite);
-	REGISTER_HANDLER(SDKLIB__afindfirst, HANDLE_NAMEONLY, "_afindfirst", _afindfirst);
-	REGISTER_HANDLER(SDKLIB__afindnext, HANDLE_NAMEONLY, "_afindnext", _afindnext);
-	REGISTER_HANDLER(SDKLIB__findclose, HANDLE_NAMEONLY, "_findclose", _findclose);
-	REGISTER_HANDLER(SDKLIB__afgetattr, HANDLE_NAMEONLY, "_afgetattr", nullptr);
-	REGISTER_HANDLER(SDKLIB__afsetattr, HANDLE_NAMEONLY, "_afsetattr", nullptr);
-	REGISTER_HANDLER(SDKLIB__aremove, HANDLE_NAMEONLY, "_aremove", _aremove);
-	REGISTER_HANDLER(SDKLIB__arename, HANDLE_NAMEONLY, "_arename", nullptr);
-	REGISTER_HANDLER(SDKLIB__afcopy, HANDLE_NAMEONLY, "_afcopy", nullptr);
-	REGISTER_HANDLER(SDKLIB__amkdir, HANDLE_IMPLEMENTED, "_amkdir", _amkdir);
-	REGISTER_HANDLER(SDKLIB__armdir, HANDLE_NAMEONLY, "_armdir", nullptr);
-	REGISTER_HANDLER(SDKLIB__achdir, HANDLE_IMPLEMENTED, "_achdir", _achdir);
-	REGISTER_HANDLER(SDKLIB__agetcurdir, HANDLE_NAMEONLY, "_agetcurdir", nullptr);
-	REGISTER_HANDLER(SDKLIB__isformateddisk, HANDLE_NAMEONLY, "_isformateddisk", nullptr);
-	REGISTER_HANDLER(SDKLIB__getfattype, HANDLE_NAMEONLY, "_getfattype", nullptr);
-	REGISTER_HANDLER(SDKLIB__setdisk, HANDLE_NAMEONLY, "_setdisk", nullptr);
-	REGISTER_HANDLER(SDKLIB__getdisk, HANDLE_NAMEONLY, "_getdisk", nullptr);
-	REGISTER_HANDLER(SDKLIB__getdiskchar, HANDLE_NAMEONLY, "_getdiskchar", nullptr);
-	REGISTER_HANDLER(SDKLIB__setdiskchar, HANDLE_NAMEONLY, "_setdiskchar", nullptr);
-	REGISTER_HANDLER(SDKLIB__getdisknum, HANDLE_NAMEONLY, "_getdisknum", nullptr);
-	REGISTER_HANDLER(SDKLIB_FSGetDiskRoomState, HANDLE_NAMEONLY, "FSGetDiskRoomState", nullptr);
-	REGISTER_HANDLER(SDKLIB__OpenFile, HANDLE_IMPLEMENTED, "_OpenFile", _OpenFile);
-	REGISTER_HANDLER(SDKLIB__OpenFileEx, HANDLE_NAMEONLY, "_OpenFileEx", nullptr);
-	REGISTER_HANDLER(SDKLIB__OpenFileW, HANDLE_NAMEONLY, "_OpenFileW", nullptr);
-	REGISTER_HANDLER(SDKLIB__CloseFile, HANDLE_NAMEONLY, "_CloseFile", nullptr);
-	REGISTER_HANDLER(SDKLIB__ReadFile, HANDLE_NAMEONLY, "_ReadFile", nullptr);
-	REGISTER_HANDLER(SDKLIB__FseekFile, HANDLE_NAMEONLY, "_FseekFile", nullptr);
-	REGISTER_HANDLER(SDKLIB__FileSize, HANDLE_NAMEONLY, "_FileSize", nullptr);
-	REGISTER_HANDLER(SDKLIB__OpenSubFile, HANDLE_NAMEONLY, "_OpenSubFile", nullptr);
-	REGISTER_HANDLER(SDKLIB__TellFile, HANDLE_NAMEONLY, "_TellFile", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBSave, HANDLE_NAMEONLY, "DBSave", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBSaveAll, HANDLE_NAMEONLY, "DBSaveAll", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBOpenUserFile, HANDLE_NAMEONLY, "DBOpenUserFile", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBCreate, HANDLE_NAMEONLY, "DBCreate", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBCreateSZ, HANDLE_NAMEONLY, "DBCreateSZ", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBOpen, HANDLE_NAMEONLY, "DBOpen", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBClose, HANDLE_NAMEONLY, "DBClose", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBRemove, HANDLE_NAMEONLY, "DBRemove", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBEmpty, HANDLE_NAMEONLY, "DBEmpty", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBOptimize, HANDLE_NAMEONLY, "DBOptimize", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBRepair, HANDLE_NAMEONLY, "DBRepair", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBGetNewRecordPID, HANDLE_NAMEONLY, "DBGetNewRecordPID", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBGetNewRecordID, HANDLE_NAMEONLY, "DBGetNewRecordID", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBCreateNewRecord, HANDLE_NAMEONLY, "DBCreateNewRecord", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBInsertRecord, HANDLE_NAMEONLY, "DBInsertRecord", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBModifyRecord, HANDLE_NAMEONLY, "DBModifyRecord", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBRemoveRecord, HANDLE_NAMEONLY, "DBRemoveRecord", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBReadRecord, HANDLE_NAMEONLY, "DBReadRecord", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBGetRecordTime, HANDLE_NAMEONLY, "DBGetRecordTime", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBGetRecordDate, HANDLE_NAMEONLY, "DBGetRecordDate", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBGetRecordPid, HANDLE_NAMEONLY, "DBGetRecordPid", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBGetCurRecordCount, HANDLE_NAMEONLY, "DBGetCurRecordCount", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBOverLoadSortFunc, HANDLE_NAMEONLY, "DBOverLoadSortFunc", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBGetRecPidState, HANDLE_NAMEONLY, "DBGetRecPidState", nullptr);
-	REGISTER_HANDLER(SDKLIB_DBGetDBState, HANDLE_NAMEONLY, "DBGetDBState", nullptr);
-	REGISTER_HANDLER(SDKLIB__GetSystemDirectory, HANDLE_NAMEONLY, "_GetSystemDirectory", nullptr);
-	REGISTER_HANDLER(SDKLIB__GetTempPath, HANDLE_NAMEONLY, "_GetTempPath", nullptr);
-	REGISTER_HANDLER(SDKLIB__GetPrivateProfileInt, HANDLE_NAMEONLY, "_GetPrivateProfileInt", nullptr);
-	REGISTER_HANDLER(SDKLIB__GetPrivateProfileString, HANDLE_IMPLEMENTED, "_GetPrivateProfileString", _GetPrivateProfileString);
-	REGISTER_HANDLER(SDKLIB__WritePrivateProfileString, HANDLE_NAMEONLY, "_WritePrivateProfileString", _SetPrivateProfileString);
-	REGISTER_HANDLER(SDKLIB_GetTadCityNo, HANDLE_NAMEONLY, "GetTadCityNo", nullptr);
-	REGISTER_HANDLER(SDKLIB_RunApplicationA, HANDLE_NAMEONLY, "RunApplicationA", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetApplicationNameA, HANDLE_NAMEONLY, "GetApplicationNameA", nullptr);
-	REGISTER_HANDLER(SDKLIB_LoadProgramA, HANDLE_NAMEONLY, "LoadProgramA", nullptr);
-	REGISTER_HANDLER(SDKLIB_FreeProgram, HANDLE_NAMEONLY, "FreeProgram", nullptr);
-	REGISTER_HANDLER(SDKLIB_ExecuteProgram, HANDLE_NAMEONLY, "ExecuteProgram", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetCurrentPathA, HANDLE_IMPLEMENTED, "GetCurrentPathA", GetCurrentExecutable);
-	REGISTER_HANDLER(SDKLIB_ProgramIsRunningA, HANDLE_IMPLEMENTED, "ProgramIsRunningA", prgrmIsRunning);
-	REGISTER_HANDLER(SDKLIB_FindApplications, HANDLE_NAMEONLY, "FindApplications", nullptr);
-	REGISTER_HANDLER(SDKLIB_FreeFindApplications, HANDLE_NAMEONLY, "FreeFindApplications", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetApplicationInfo, HANDLE_NAMEONLY, "GetApplicationInfo", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateAppView, HANDLE_NAMEONLY, "CreateAppView", nullptr);
-	REGISTER_HANDLER(SDKLIB_TextPicker, HANDLE_NAMEONLY, "TextPicker", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetMonDays, HANDLE_NAMEONLY, "GetMonDays", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetWeekDay, HANDLE_NAMEONLY, "GetWeekDay", nullptr);
-	REGISTER_HANDLER(SDKLIB_ConvSolarToLunar, HANDLE_NAMEONLY, "ConvSolarToLunar", nullptr);
-	REGISTER_HANDLER(SDKLIB_ConvLunarToSolar, HANDLE_NAMEONLY, "ConvLunarToSolar", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetLeapMonth, HANDLE_NAMEONLY, "GetLeapMonth", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateEdit, HANDLE_NAMEONLY, "CreateEdit", nullptr);
-	REGISTER_HANDLER(SDKLIB_EDInitEdit, HANDLE_NAMEONLY, "EDInitEdit", nullptr);
-	REGISTER_HANDLER(SDKLIB_EDDraw, HANDLE_NAMEONLY, "EDDraw", nullptr);
-	REGISTER_HANDLER(SDKLIB_EDDrawText, HANDLE_NAMEONLY, "EDDrawText", nullptr);
-	REGISTER_HANDLER(SDKLIB_EDHandleEvent, HANDLE_NAMEONLY, "EDHandleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_InsertTextField, HANDLE_NAMEONLY, "InsertTextField", nullptr);
-	REGISTER_HANDLER(SDKLIB_ReplaceEditBuffer, HANDLE_NAMEONLY, "ReplaceEditBuffer", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetEditCmdFunc, HANDLE_NAMEONLY, "SetEditCmdFunc", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetEditCmdFunc, HANDLE_NAMEONLY, "GetEditCmdFunc", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetEditFunctionMenuState, HANDLE_NAMEONLY, "SetEditFunctionMenuState", nullptr);
-	REGISTER_HANDLER(SDKLIB_DatePicker, HANDLE_NAMEONLY, "DatePicker", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateBoolDateField, HANDLE_NAMEONLY, "CreateBoolDateField", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateBoolMenuField, HANDLE_NAMEONLY, "CreateBoolMenuField", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateBoolField, HANDLE_NAMEONLY, "CreateBoolField", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateBoolTextField, HANDLE_NAMEONLY, "CreateBoolTextField", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateTimeField, HANDLE_NAMEONLY, "CreateTimeField", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateDateField, HANDLE_NAMEONLY, "CreateDateField", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateDoubleTimeField, HANDLE_NAMEONLY, "CreateDoubleTimeField", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateNumericField, HANDLE_NAMEONLY, "CreateNumericField", nullptr);
-	REGISTER_HANDLER(SDKLIB_PDATEFIELD_draw, HANDLE_NAMEONLY, "PDATEFIELD_draw", nullptr);
-	REGISTER_HANDLER(SDKLIB_PDATEFIELD_handleEvent, HANDLE_NAMEONLY, "PDATEFIELD_handleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_PDATEFIELD_setState, HANDLE_NAMEONLY, "PDATEFIELD_setState", nullptr);
-	REGISTER_HANDLER(SDKLIB_PNUMERICFIELD_handleEvent, HANDLE_NAMEONLY, "PNUMERICFIELD_handleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_PBOOLFIELD_draw, HANDLE_NAMEONLY, "PBOOLFIELD_draw", nullptr);
-	REGISTER_HANDLER(SDKLIB_MessageBox, HANDLE_NAMEONLY, "MessageBox", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateMessageBox, HANDLE_NAMEONLY, "CreateMessageBox", nullptr);
-	REGISTER_HANDLER(SDKLIB_NumericPicker, HANDLE_NAMEONLY, "NumericPicker", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetNumPkValidHandle, HANDLE_NAMEONLY, "SetNumPkValidHandle", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateDetailView, HANDLE_NAMEONLY, "CreateDetailView", nullptr);
-	REGISTER_HANDLER(SDKLIB_PDETAILVIEW_draw, HANDLE_NAMEONLY, "PDETAILVIEW_draw", nullptr);
-	REGISTER_HANDLER(SDKLIB_NumericToStr, HANDLE_NAMEONLY, "NumericToStr", nullptr);
-	REGISTER_HANDLER(SDKLIB_StrToNumeric, HANDLE_NAMEONLY, "StrToNumeric", nullptr);
-	REGISTER_HANDLER(SDKLIB_AllocBlock, HANDLE_NAMEONLY, "AllocBlock", nullptr);
-	REGISTER_HANDLER(SDKLIB_FreeBlock, HANDLE_NAMEONLY, "FreeBlock", nullptr);
-	REGISTER_HANDLER(SDKLIB_RelatedKeyButton, HANDLE_NAMEONLY, "RelatedKeyButton", nullptr);
-	REGISTER_HANDLER(SDKLIB_RelatedKeyButtonEx, HANDLE_NAMEONLY, "RelatedKeyButtonEx", nullptr);
-	REGISTER_HANDLER(SDKLIB_UnRelatedKeyButton, HANDLE_NAMEONLY, "UnRelatedKeyButton", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateButton, HANDLE_NAMEONLY, "CreateButton", nullptr);
-	REGISTER_HANDLER(SDKLIB_ChangeButton, HANDLE_NAMEONLY, "ChangeButton", nullptr);
-	REGISTER_HANDLER(SDKLIB_InsertButton, HANDLE_NAMEONLY, "InsertButton", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateStatic, HANDLE_NAMEONLY, "CreateStatic", nullptr);
-	REGISTER_HANDLER(SDKLIB_PBUTTON_draw, HANDLE_NAMEONLY, "PBUTTON_draw", nullptr);
-	REGISTER_HANDLER(SDKLIB_InsertImageClip, HANDLE_NAMEONLY, "InsertImageClip", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreatePageArrow, HANDLE_NAMEONLY, "CreatePageArrow", nullptr);
-	REGISTER_HANDLER(SDKLIB_InsertPgUpDn, HANDLE_NAMEONLY, "InsertPgUpDn", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateHorPageArrow, HANDLE_NAMEONLY, "CreateHorPageArrow", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateControlMenu, HANDLE_NAMEONLY, "CreateControlMenu", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateMenuField, HANDLE_NAMEONLY, "CreateMenuField", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateNumberSet, HANDLE_NAMEONLY, "CreateNumberSet", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateStackedList, HANDLE_NAMEONLY, "CreateStackedList", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateSlider, HANDLE_NAMEONLY, "CreateSlider", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateProgress, HANDLE_NAMEONLY, "CreateProgress", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateRadioButton, HANDLE_NAMEONLY, "CreateRadioButton", nullptr);
-	REGISTER_HANDLER(SDKLIB_PPROGRESSetPos, HANDLE_NAMEONLY, "PPROGRESSetPos", nullptr);
-	REGISTER_HANDLER(SDKLIB_PPROGRESSetRange, HANDLE_NAMEONLY, "PPROGRESSetRange", nullptr);
-	REGISTER_HANDLER(SDKLIB_PSLIDER_SetPos, HANDLE_NAMEONLY, "PSLIDER_SetPos", nullptr);
-	REGISTER_HANDLER(SDKLIB_PSLIDER_SetRange, HANDLE_NAMEONLY, "PSLIDER_SetRange", nullptr);
-	REGISTER_HANDLER(SDKLIB_PSLIDER_handleEvent, HANDLE_NAMEONLY, "PSLIDER_handleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_IsRadioButtonCheck, HANDLE_NAMEONLY, "IsRadioButtonCheck", nullptr);
-	REGISTER_HANDLER(SDKLIB_CheckDeskRadioButton, HANDLE_NAMEONLY, "CheckDeskRadioButton", nullptr);
-	REGISTER_HANDLER(SDKLIB_PNUMBERSET_handleEvent, HANDLE_NAMEONLY, "PNUMBERSET_handleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_PMENUFIELD_draw, HANDLE_NAMEONLY, "PMENUFIELD_draw", nullptr);
-	REGISTER_HANDLER(SDKLIB_PMENUFIELD_handleEvent, HANDLE_NAMEONLY, "PMENUFIELD_handleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_PCONTROLMENU_draw, HANDLE_NAMEONLY, "PCONTROLMENU_draw", nullptr);
-	REGISTER_HANDLER(SDKLIB_PCONTROLMENU_handleEvent, HANDLE_NAMEONLY, "PCONTROLMENU_handleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_PVIEW_draw, HANDLE_NAMEONLY, "PVIEW_draw", nullptr);
-	REGISTER_HANDLER(SDKLIB_PVIEW_EraseBackGround, HANDLE_NAMEONLY, "PVIEW_EraseBackGround", nullptr);
-	REGISTER_HANDLER(SDKLIB_PVIEW_handleEvent, HANDLE_NAMEONLY, "PVIEW_handleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_PVIEW_setState, HANDLE_NAMEONLY, "PVIEW_setState", nullptr);
-	REGISTER_HANDLER(SDKLIB_PGROUP_draw, HANDLE_NAMEONLY, "PGROUP_draw", nullptr);
-	REGISTER_HANDLER(SDKLIB_PGROUP_handleEvent, HANDLE_NAMEONLY, "PGROUP_handleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_PGROUP_insert, HANDLE_NAMEONLY, "PGROUP_insert", nullptr);
-	REGISTER_HANDLER(SDKLIB_PGROUP_redraw, HANDLE_NAMEONLY, "PGROUP_redraw", nullptr);
-	REGISTER_HANDLER(SDKLIB_PGROUP_setCurrent, HANDLE_NAMEONLY, "PGROUP_setCurrent", nullptr);
-	REGISTER_HANDLER(SDKLIB_PGROUP_setState, HANDLE_NAMEONLY, "PGROUP_setState", nullptr);
-	REGISTER_HANDLER(SDKLIB_PGROUP_execute, HANDLE_NAMEONLY, "PGROUP_execute", nullptr);
-	REGISTER_HANDLER(SDKLIB_PGROUP_preView, HANDLE_NAMEONLY, "PGROUP_preView", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateDeskBox, HANDLE_NAMEONLY, "CreateDeskBox", nullptr);
-	REGISTER_HANDLER(SDKLIB_PDESKBOX_draw, HANDLE_NAMEONLY, "PDESKBOX_draw", nullptr);
-	REGISTER_HANDLER(SDKLIB_PDESKBOX_drawTitle, HANDLE_NAMEONLY, "PDESKBOX_drawTitle", nullptr);
-	REGISTER_HANDLER(SDKLIB_PDESKBOX_handleEvent, HANDLE_NAMEONLY, "PDESKBOX_handleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_PDESKBOX_redraw, HANDLE_NAMEONLY, "PDESKBOX_redraw", nullptr);
-	REGISTER_HANDLER(SDKLIB_Destroy, HANDLE_NAMEONLY, "Destroy", nullptr);
-	REGISTER_HANDLER(SDKLIB_DeskBox_construct, HANDLE_NAMEONLY, "DeskBox_construct", nullptr);
-	REGISTER_HANDLER(SDKLIB_DrawDeskBoxBound, HANDLE_NAMEONLY, "DrawDeskBoxBound", nullptr);
-	REGISTER_HANDLER(SDKLIB_ChangeCommandMenu, HANDLE_NAMEONLY, "ChangeCommandMenu", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetDeskBoxReturn, HANDLE_NAMEONLY, "SetDeskBoxReturn", nullptr);
-	REGISTER_HANDLER(SDKLIB_ExecView, HANDLE_NAMEONLY, "ExecView", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetExitWordVal, HANDLE_NAMEONLY, "SetExitWordVal", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetExitWordVal, HANDLE_NAMEONLY, "GetExitWordVal", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetCurModeWord, HANDLE_NAMEONLY, "SetCurModeWord", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetCurModeWord, HANDLE_NAMEONLY, "GetCurModeWord", nullptr);
-	REGISTER_HANDLER(SDKLIB_InsertTitleBarButton, HANDLE_NAMEONLY, "InsertTitleBarButton", nullptr);
-	REGISTER_HANDLER(SDKLIB_Delete, HANDLE_NAMEONLY, "Delete", nullptr);
-	REGISTER_HANDLER(SDKLIB_DisableCommand, HANDLE_NAMEONLY, "DisableCommand", nullptr);
-	REGISTER_HANDLER(SDKLIB_EnableCommand, HANDLE_NAMEONLY, "EnableCommand", nullptr);
-	REGISTER_HANDLER(SDKLIB_InverseSetAreaArc, HANDLE_NAMEONLY, "InverseSetAreaArc", nullptr);
-	REGISTER_HANDLER(SDKLIB_InverseSetAreaColor, HANDLE_NAMEONLY, "InverseSetAreaColor", nullptr);
-	REGISTER_HANDLER(SDKLIB_InverseSetAreaArcColor, HANDLE_NAMEONLY, "InverseSetAreaArcColor", nullptr);
-	REGISTER_HANDLER(SDKLIB_SendMessage, HANDLE_NAMEONLY, "SendMessage", nullptr);
-	REGISTER_HANDLER(SDKLIB_SendMessageExt, HANDLE_NAMEONLY, "SendMessageExt", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetPreView, HANDLE_NAMEONLY, "GetPreView", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetFocuseItem, HANDLE_NAMEONLY, "SetFocuseItem", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetTabOrder, HANDLE_NAMEONLY, "SetTabOrder", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetDeskEntry, HANDLE_NAMEONLY, "GetDeskEntry", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetDeskItem, HANDLE_NAMEONLY, "GetDeskItem", nullptr);
-	REGISTER_HANDLER(SDKLIB_QueryByCommand, HANDLE_NAMEONLY, "QueryByCommand", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetMaxScrX, HANDLE_NAMEONLY, "GetMaxScrX", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetMaxScrY, HANDLE_NAMEONLY, "GetMaxScrY", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetDeskClientRect, HANDLE_NAMEONLY, "GetDeskClientRect", nullptr);
-	REGISTER_HANDLER(SDKLIB_InvalidateRect, HANDLE_NAMEONLY, "InvalidateRect", nullptr);
-	REGISTER_HANDLER(SDKLIB_InsertSplitViewFrame, HANDLE_NAMEONLY, "InsertSplitViewFrame", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateSplitView, HANDLE_NAMEONLY, "CreateSplitView", nullptr);
-	REGISTER_HANDLER(SDKLIB_InsertSplitView, HANDLE_NAMEONLY, "InsertSplitView", nullptr);
-	REGISTER_HANDLER(SDKLIB_PSPLITVIEW_draw, HANDLE_NAMEONLY, "PSPLITVIEW_draw", nullptr);
-	REGISTER_HANDLER(SDKLIB_PSPLITVIEW_handleEvent, HANDLE_NAMEONLY, "PSPLITVIEW_handleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_PSPLITVIEW_setState, HANDLE_NAMEONLY, "PSPLITVIEW_setState", nullptr);
-	REGISTER_HANDLER(SDKLIB_InsertMultiPage, HANDLE_NAMEONLY, "InsertMultiPage", nullptr);
-	REGISTER_HANDLER(SDKLIB_PPAGE_draw, HANDLE_NAMEONLY, "PPAGE_draw", nullptr);
-	REGISTER_HANDLER(SDKLIB_PPAGE_handleEvent, HANDLE_NAMEONLY, "PPAGE_handleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_PMPAGE_insertPage, HANDLE_NAMEONLY, "PMPAGE_insertPage", nullptr);
-	REGISTER_HANDLER(SDKLIB_PMPAGE_handleEvent, HANDLE_NAMEONLY, "PMPAGE_handleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_ConverNumToStr, HANDLE_NAMEONLY, "ConverNumToStr", nullptr);
-	REGISTER_HANDLER(SDKLIB_ConverTimeToStr, HANDLE_NAMEONLY, "ConverTimeToStr", nullptr);
-	REGISTER_HANDLER(SDKLIB_DateToString, HANDLE_NAMEONLY, "DateToString", nullptr);
-	REGISTER_HANDLER(SDKLIB_TimeToString, HANDLE_NAMEONLY, "TimeToString", nullptr);
-	REGISTER_HANDLER(SDKLIB_ZfxGetWeekDay, HANDLE_NAMEONLY, "ZfxGetWeekDay", nullptr);
-	REGISTER_HANDLER(SDKLIB_WriteNumber, HANDLE_NAMEONLY, "WriteNumber", nullptr);
-	REGISTER_HANDLER(SDKLIB_ConverDateToStr, HANDLE_NAMEONLY, "ConverDateToStr", nullptr);
-	REGISTER_HANDLER(SDKLIB_PopUpList, HANDLE_NAMEONLY, "PopUpList", nullptr);
-	REGISTER_HANDLER(SDKLIB_PressAtRange, HANDLE_NAMEONLY, "PressAtRange", nullptr);
-	REGISTER_HANDLER(SDKLIB_PressAtButton, HANDLE_NAMEONLY, "PressAtButton", nullptr);
-	REGISTER_HANDLER(SDKLIB_PressAtButtonInv, HANDLE_NAMEONLY, "PressAtButtonInv", nullptr);
-	REGISTER_HANDLER(SDKLIB_PressAtButtonIconAddr, HANDLE_NAMEONLY, "PressAtButtonIconAddr", nullptr);
-	REGISTER_HANDLER(SDKLIB_PressAtButtonIcon, HANDLE_NAMEONLY, "PressAtButtonIcon", nullptr);
-	REGISTER_HANDLER(SDKLIB_IsSystemItemID, HANDLE_NAMEONLY, "IsSystemItemID", nullptr);
-	REGISTER_HANDLER(SDKLIB_WaitingMessageBox, HANDLE_NAMEONLY, "WaitingMessageBox", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateCalendar, HANDLE_NAMEONLY, "CreateCalendar", nullptr);
-	REGISTER_HANDLER(SDKLIB_PCALENDAR_draw, HANDLE_NAMEONLY, "PCALENDAR_draw", nullptr);
-	REGISTER_HANDLER(SDKLIB_PCALENDAR_handleEvent, HANDLE_NAMEONLY, "PCALENDAR_handleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateScrollBar, HANDLE_NAMEONLY, "CreateScrollBar", nullptr);
-	REGISTER_HANDLER(SDKLIB_InsertScrollBar, HANDLE_NAMEONLY, "InsertScrollBar", nullptr);
-	REGISTER_HANDLER(SDKLIB_InsertScrollBarPosition, HANDLE_NAMEONLY, "InsertScrollBarPosition", nullptr);
-	REGISTER_HANDLER(SDKLIB_PSCROLLBAR_draw, HANDLE_NAMEONLY, "PSCROLLBAR_draw", nullptr);
-	REGISTER_HANDLER(SDKLIB_PSCROLLBAR_redraw, HANDLE_NAMEONLY, "PSCROLLBAR_redraw", nullptr);
-	REGISTER_HANDLER(SDKLIB_PSCROLLBAR_handleEvent, HANDLE_NAMEONLY, "PSCROLLBAR_handleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_ChangeScrollBarValue, HANDLE_NAMEONLY, "ChangeScrollBarValue", nullptr);
-	REGISTER_HANDLER(SDKLIB_ChangeScrollBarStep, HANDLE_NAMEONLY, "ChangeScrollBarStep", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetScrollBarValue, HANDLE_NAMEONLY, "SetScrollBarValue", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetScrollBarStep, HANDLE_NAMEONLY, "SetScrollBarStep", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateLister, HANDLE_NAMEONLY, "CreateLister", nullptr);
-	REGISTER_HANDLER(SDKLIB_PLISTER_draw, HANDLE_NAMEONLY, "PLISTER_draw", nullptr);
-	REGISTER_HANDLER(SDKLIB_PLISTER_handleEvent, HANDLE_NAMEONLY, "PLISTER_handleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_PLISTER_writeItem, HANDLE_NAMEONLY, "PLISTER_writeItem", nullptr);
-	REGISTER_HANDLER(SDKLIB_PLISTER_penDownAct, HANDLE_NAMEONLY, "PLISTER_penDownAct", nullptr);
-	REGISTER_HANDLER(SDKLIB_PLISTER_changeFocuseAct, HANDLE_NAMEONLY, "PLISTER_changeFocuseAct", nullptr);
-	REGISTER_HANDLER(SDKLIB_ChangeListRowHeight, HANDLE_NAMEONLY, "ChangeListRowHeight", nullptr);
-	REGISTER_HANDLER(SDKLIB_ChangeListItemSum, HANDLE_NAMEONLY, "ChangeListItemSum", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateLongLister, HANDLE_NAMEONLY, "CreateLongLister", nullptr);
-	REGISTER_HANDLER(SDKLIB_PLONGLISTER_draw, HANDLE_NAMEONLY, "PLONGLISTER_draw", nullptr);
-	REGISTER_HANDLER(SDKLIB_PLONGLISTER_handleEvent, HANDLE_NAMEONLY, "PLONGLISTER_handleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_PLONGLISTER_changeFocuseAct, HANDLE_NAMEONLY, "PLONGLISTER_changeFocuseAct", nullptr);
-	REGISTER_HANDLER(SDKLIB_PLONGLISTER_writeItem, HANDLE_NAMEONLY, "PLONGLISTER_writeItem", nullptr);
-	REGISTER_HANDLER(SDKLIB_PLONGLISTER_penDownAct, HANDLE_NAMEONLY, "PLONGLISTER_penDownAct", nullptr);
-	REGISTER_HANDLER(SDKLIB_ChangeLongListItemSum, HANDLE_NAMEONLY, "ChangeLongListItemSum", nullptr);
-	REGISTER_HANDLER(SDKLIB_ChangeLongListRowHeight, HANDLE_NAMEONLY, "ChangeLongListRowHeight", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetSysColorConfig, HANDLE_NAMEONLY, "SetSysColorConfig", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetSysColorConfig, HANDLE_NAMEONLY, "GetSysColorConfig", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetSysColor, HANDLE_NAMEONLY, "GetSysColor", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetSysColor, HANDLE_NAMEONLY, "SetSysColor", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetDefaultSysIconCfg, HANDLE_NAMEONLY, "SetDefaultSysIconCfg", nullptr);
-	REGISTER_HANDLER(SDKLIB_DrawGradientRect, HANDLE_NAMEONLY, "DrawGradientRect", nullptr);
-	REGISTER_HANDLER(SDKLIB_TimePicker, HANDLE_NAMEONLY, "TimePicker", nullptr);
-	REGISTER_HANDLER(SDKLIB__GetOpenFileName, HANDLE_NAMEONLY, "_GetOpenFileName", nullptr);
-	REGISTER_HANDLER(SDKLIB__GetSaveFileName, HANDLE_NAMEONLY, "_GetSaveFileName", nullptr);
-	REGISTER_HANDLER(SDKLIB__GetNextFileName, HANDLE_NAMEONLY, "_GetNextFileName", nullptr);
-	REGISTER_HANDLER(SDKLIB_InsertFileFilter, HANDLE_NAMEONLY, "InsertFileFilter", nullptr);
-	REGISTER_HANDLER(SDKLIB_PFILEFILTER_draw, HANDLE_NAMEONLY, "PFILEFILTER_draw", nullptr);
-	REGISTER_HANDLER(SDKLIB_PFILEFILTER_handleEvent, HANDLE_NAMEONLY, "PFILEFILTER_handleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_PFILEFILTER_chgColumnText, HANDLE_NAMEONLY, "PFILEFILTER_chgColumnText", nullptr);
-	REGISTER_HANDLER(SDKLIB_PFILEFILTER_setPathInfo, HANDLE_NAMEONLY, "PFILEFILTER_setPathInfo", nullptr);
-	REGISTER_HANDLER(SDKLIB_PFILEFILTER_getFillMode, HANDLE_NAMEONLY, "PFILEFILTER_getFillMode", nullptr);
-	REGISTER_HANDLER(SDKLIB_PFILEFILTER_setFillMode, HANDLE_NAMEONLY, "PFILEFILTER_setFillMode", nullptr);
-	REGISTER_HANDLER(SDKLIB_PFILEFILTER_getItemName, HANDLE_NAMEONLY, "PFILEFILTER_getItemName", nullptr);
-	REGISTER_HANDLER(SDKLIB_PFILEFILTER_writeColumn0, HANDLE_NAMEONLY, "PFILEFILTER_writeColumn0", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetFileExecuteFunction, HANDLE_NAMEONLY, "GetFileExecuteFunction", nullptr);
-	REGISTER_HANDLER(SDKLIB__EditFileName, HANDLE_NAMEONLY, "_EditFileName", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_GetHandActiveState, HANDLE_NAMEONLY, "IME_GetHandActiveState", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_GetCtrlSize, HANDLE_NAMEONLY, "IME_GetCtrlSize", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_ActiveCtrl, HANDLE_NAMEONLY, "IME_ActiveCtrl", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_IsActiveInputer, HANDLE_NAMEONLY, "IME_IsActiveInputer", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_SetDefault, HANDLE_NAMEONLY, "IME_SetDefault", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_GetLXResult, HANDLE_NAMEONLY, "IME_GetLXResult", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_SetHandFilter, HANDLE_NAMEONLY, "IME_SetHandFilter", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_GetHandFilter, HANDLE_NAMEONLY, "IME_GetHandFilter", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_IsFuncKey, HANDLE_NAMEONLY, "IME_IsFuncKey", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_SearchKeyMap, HANDLE_NAMEONLY, "IME_SearchKeyMap", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_IsSelectKey, HANDLE_NAMEONLY, "IME_IsSelectKey", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_SaveUserInfo, HANDLE_NAMEONLY, "IME_SaveUserInfo", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_ReadUserInfo, HANDLE_NAMEONLY, "IME_ReadUserInfo", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_IsEmptyFont, HANDLE_NAMEONLY, "IME_IsEmptyFont", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_SetHandWrtConfig, HANDLE_NAMEONLY, "IME_SetHandWrtConfig", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_SetHandWrtStudyFlag, HANDLE_NAMEONLY, "IME_SetHandWrtStudyFlag", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_SetRecognizeFlag, HANDLE_NAMEONLY, "IME_SetRecognizeFlag", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_GetCtrl, HANDLE_NAMEONLY, "IME_GetCtrl", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_GetCtrlState, HANDLE_NAMEONLY, "IME_GetCtrlState", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_GetViewInfo, HANDLE_NAMEONLY, "IME_GetViewInfo", nullptr);
-	REGISTER_HANDLER(SDKLIB_SCcorrection, HANDLE_NAMEONLY, "SCcorrection", nullptr);
-	REGISTER_HANDLER(SDKLIB_SCwildcard, HANDLE_NAMEONLY, "SCwildcard", nullptr);
-	REGISTER_HANDLER(SDKLIB_SCverify, HANDLE_NAMEONLY, "SCverify", nullptr);
-	REGISTER_HANDLER(SDKLIB_InitialSpelling, HANDLE_NAMEONLY, "InitialSpelling", nullptr);
-	REGISTER_HANDLER(SDKLIB_SCopenDatabase, HANDLE_NAMEONLY, "SCopenDatabase", nullptr);
-	REGISTER_HANDLER(SDKLIB_SCcloseDatabase, HANDLE_NAMEONLY, "SCcloseDatabase", nullptr);
-	REGISTER_HANDLER(SDKLIB_SCGetMaxWordLen, HANDLE_NAMEONLY, "SCGetMaxWordLen", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetTotalItem, HANDLE_NAMEONLY, "GetTotalItem", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetMaxBlockSize, HANDLE_NAMEONLY, "GetMaxBlockSize", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetKeyWord, HANDLE_NAMEONLY, "GetKeyWord", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetAllContent, HANDLE_NAMEONLY, "GetAllContent", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetSaveAddress, HANDLE_NAMEONLY, "GetSaveAddress", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetAlpExit, HANDLE_NAMEONLY, "GetAlpExit", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetAlpExit, HANDLE_NAMEONLY, "SetAlpExit", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetDictFont, HANDLE_NAMEONLY, "SetDictFont", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetDictFont, HANDLE_NAMEONLY, "GetDictFont", nullptr);
-	REGISTER_HANDLER(SDKLIB_UniversalCrossSearch, HANDLE_NAMEONLY, "UniversalCrossSearch", nullptr);
-	REGISTER_HANDLER(SDKLIB_UniversalDictList, HANDLE_NAMEONLY, "UniversalDictList", nullptr);
-	REGISTER_HANDLER(SDKLIB_UniversalDictListForAll, HANDLE_NAMEONLY, "UniversalDictListForAll", nullptr);
-	REGISTER_HANDLER(SDKLIB_UniversalCardList, HANDLE_NAMEONLY, "UniversalCardList", nullptr);
-	REGISTER_HANDLER(SDKLIB_SearchEveryWay, HANDLE_NAMEONLY, "SearchEveryWay", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetAddDictPosInList, HANDLE_NAMEONLY, "GetAddDictPosInList", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetCurrentCardDictNum, HANDLE_NAMEONLY, "GetCurrentCardDictNum", nullptr);
-	REGISTER_HANDLER(SDKLIB_SearchCurrentCardDictInfo, HANDLE_NAMEONLY, "SearchCurrentCardDictInfo", nullptr);
-	REGISTER_HANDLER(SDKLIB_ReleaseCardDictInfo, HANDLE_NAMEONLY, "ReleaseCardDictInfo", nullptr);
-	REGISTER_HANDLER(SDKLIB_PRICHVIEW_SetBufferAttrib, HANDLE_NAMEONLY, "PRICHVIEW_SetBufferAttrib", nullptr);
-	REGISTER_HANDLER(SDKLIB_PRICHVIEW_SpeechForRich, HANDLE_NAMEONLY, "PRICHVIEW_SpeechForRich", nullptr);
-	REGISTER_HANDLER(SDKLIB_IsDictOuYu, HANDLE_NAMEONLY, "IsDictOuYu", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateRichView, HANDLE_NAMEONLY, "CreateRichView", nullptr);
-	REGISTER_HANDLER(SDKLIB_AddScrollBarToRichview, HANDLE_NAMEONLY, "AddScrollBarToRichview", nullptr);
-	REGISTER_HANDLER(SDKLIB_ChangeScrollBarToRichview, HANDLE_NAMEONLY, "ChangeScrollBarToRichview", nullptr);
-	REGISTER_HANDLER(SDKLIB_ChangeScrollBarPos, HANDLE_NAMEONLY, "ChangeScrollBarPos", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetDisplayMode, HANDLE_NAMEONLY, "SetDisplayMode", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetShowSearchLayer, HANDLE_NAMEONLY, "SetShowSearchLayer", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetWindowState, HANDLE_NAMEONLY, "SetWindowState", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetWindowState, HANDLE_NAMEONLY, "GetWindowState", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetBaseLine, HANDLE_NAMEONLY, "GetBaseLine", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetBaseLine, HANDLE_NAMEONLY, "SetBaseLine", nullptr);
-	REGISTER_HANDLER(SDKLIB_BackupWindowState, HANDLE_NAMEONLY, "BackupWindowState", nullptr);
-	REGISTER_HANDLER(SDKLIB_RestoreWindowState, HANDLE_NAMEONLY, "RestoreWindowState", nullptr);
-	REGISTER_HANDLER(SDKLIB_PRICHVIEW_draw, HANDLE_NAMEONLY, "PRICHVIEW_draw", nullptr);
-	REGISTER_HANDLER(SDKLIB_PRICHVIEW_handleEvent, HANDLE_NAMEONLY, "PRICHVIEW_handleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetMarkString, HANDLE_NAMEONLY, "GetMarkString", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetRichWindowState, HANDLE_NAMEONLY, "GetRichWindowState", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetShowMode, HANDLE_NAMEONLY, "SetShowMode", nullptr);
-	REGISTER_HANDLER(SDKLIB_PRICHVIEW_ShowSearchLayer, HANDLE_NAMEONLY, "PRICHVIEW_ShowSearchLayer", nullptr);
-	REGISTER_HANDLER(SDKLIB_PRICHVIEW_SetStateForUser, HANDLE_NAMEONLY, "PRICHVIEW_SetStateForUser", nullptr);
-	REGISTER_HANDLER(SDKLIB_PRICHVIEW_WriteString, HANDLE_NAMEONLY, "PRICHVIEW_WriteString", nullptr);
-	REGISTER_HANDLER(SDKLIB_RichViewSetColor, HANDLE_NAMEONLY, "RichViewSetColor", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetTotalLine, HANDLE_NAMEONLY, "SetTotalLine", nullptr);
-	REGISTER_HANDLER(SDKLIB_ShowRichContentOnly, HANDLE_NAMEONLY, "ShowRichContentOnly", nullptr);
-	REGISTER_HANDLER(SDKLIB_PRICHVIEW_SetCttsType, HANDLE_NAMEONLY, "PRICHVIEW_SetCttsType", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetDefLineEditorInfo, HANDLE_NAMEONLY, "SetDefLineEditorInfo", nullptr);
-	REGISTER_HANDLER(SDKLIB_LineEditor, HANDLE_NAMEONLY, "LineEditor", nullptr);
-	REGISTER_HANDLER(SDKLIB_LineEditor_handleEvent, HANDLE_NAMEONLY, "LineEditor_handleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_DictEditor_handleEvent, HANDLE_NAMEONLY, "DictEditor_handleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_LEModuleForUser, HANDLE_NAMEONLY, "LEModuleForUser", nullptr);
-	REGISTER_HANDLER(SDKLIB_LineEditor_ModuleForUser, HANDLE_NAMEONLY, "LineEditor_ModuleForUser", nullptr);
-	REGISTER_HANDLER(SDKLIB_LEDictWiseSearch, HANDLE_NAMEONLY, "LEDictWiseSearch", nullptr);
-	REGISTER_HANDLER(SDKLIB_IsWildCard, HANDLE_NAMEONLY, "IsWildCard", nullptr);
-	REGISTER_HANDLER(SDKLIB_LEditor_draw, HANDLE_NAMEONLY, "LEditor_draw", nullptr);
-	REGISTER_HANDLER(SDKLIB_LINEEDITOR_changeFocuseAct, HANDLE_NAMEONLY, "LINEEDITOR_changeFocuseAct", nullptr);
-	REGISTER_HANDLER(SDKLIB_LEDSK_handleEvent, HANDLE_NAMEONLY, "LEDSK_handleEvent", nullptr);
-	REGISTER_HANDLER(SDKLIB_LineEditorCompareStr, HANDLE_NAMEONLY, "LineEditorCompareStr", nullptr);
-	REGISTER_HANDLER(SDKLIB_LineEditorWiseSearch, HANDLE_NAMEONLY, "LineEditorWiseSearch", nullptr);
-	REGISTER_HANDLER(SDKLIB_SearchDict, HANDLE_NAMEONLY, "SearchDict", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetSearchDictShortName, HANDLE_NAMEONLY, "GetSearchDictShortName", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetCurrentMainDictNum, HANDLE_NAMEONLY, "GetCurrentMainDictNum", nullptr);
-	REGISTER_HANDLER(SDKLIB_PRICHVIEW_OKSpeechForRich, HANDLE_NAMEONLY, "PRICHVIEW_OKSpeechForRich", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetIndexHcaOffset, HANDLE_NAMEONLY, "GetIndexHcaOffset", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetIndexIconOffset, HANDLE_NAMEONLY, "GetIndexIconOffset", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetAppIndexIconOffset, HANDLE_NAMEONLY, "GetAppIndexIconOffset", nullptr);
-	REGISTER_HANDLER(SDKLIB_LoadHCAToGraphicByIdx, HANDLE_NAMEONLY, "LoadHCAToGraphicByIdx", nullptr);
-	REGISTER_HANDLER(SDKLIB_LoadHCAToGraphicHeadByIdx, HANDLE_NAMEONLY, "LoadHCAToGraphicHeadByIdx", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetIndexHCAHeight, HANDLE_NAMEONLY, "GetIndexHCAHeight", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetIndexHCAWidth, HANDLE_NAMEONLY, "GetIndexHCAWidth", nullptr);
-	REGISTER_HANDLER(SDKLIB_ShowHCAByOffset, HANDLE_NAMEONLY, "ShowHCAByOffset", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetHCATransparentMode, HANDLE_NAMEONLY, "SetHCATransparentMode", nullptr);
-	REGISTER_HANDLER(SDKLIB_ReleaseHcaCache, HANDLE_NAMEONLY, "ReleaseHcaCache", nullptr);
-	REGISTER_HANDLER(SDKLIB_ResetCache, HANDLE_NAMEONLY, "ResetCache", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetLibDataindexOffset, HANDLE_NAMEONLY, "SetLibDataindexOffset", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetLibAddrFromID, HANDLE_NAMEONLY, "GetLibAddrFromID", nullptr);
-	REGISTER_HANDLER(SDKLIB_ShowBookProFromFile, HANDLE_NAMEONLY, "ShowBookProFromFile", nullptr);
-	REGISTER_HANDLER(SDKLIB_RunBook, HANDLE_NAMEONLY, "RunBook", nullptr);
-	REGISTER_HANDLER(SDKLIB_ShowBook, HANDLE_NAMEONLY, "ShowBook", nullptr);
-	REGISTER_HANDLER(SDKLIB_ShowBookPreview, HANDLE_NAMEONLY, "ShowBookPreview", nullptr);
-	REGISTER_HANDLER(SDKLIB_ShowBookEx, HANDLE_NAMEONLY, "ShowBookEx", nullptr);
-	REGISTER_HANDLER(SDKLIB_USBMassStorageRun, HANDLE_NAMEONLY, "USBMassStorageRun", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetPassThroughCallBack, HANDLE_NAMEONLY, "SetPassThroughCallBack", nullptr);
-	REGISTER_HANDLER(SDKLIB_ctts_predict, HANDLE_NAMEONLY, "ctts_predict", nullptr);
-	REGISTER_HANDLER(SDKLIB_ctts_nounce, HANDLE_NAMEONLY, "ctts_nounce", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetAllVoiceState, HANDLE_NAMEONLY, "SetAllVoiceState", nullptr);
-	REGISTER_HANDLER(SDKLIB_OpenPCMCodec, HANDLE_NAMEONLY, "OpenPCMCodec", nullptr);
-	REGISTER_HANDLER(SDKLIB_ClosePCMCodec, HANDLE_NAMEONLY, "ClosePCMCodec", nullptr);
-	REGISTER_HANDLER(SDKLIB_AudioPlayBackPause, HANDLE_NAMEONLY, "AudioPlayBackPause", nullptr);
-	REGISTER_HANDLER(SDKLIB_AudioPlayBackContinue, HANDLE_NAMEONLY, "AudioPlayBackContinue", nullptr);
-	REGISTER_HANDLER(SDKLIB_PlayWaveData, HANDLE_NAMEONLY, "PlayWaveData", nullptr);
-	REGISTER_HANDLER(SDKLIB_StopWaveDataPlay, HANDLE_NAMEONLY, "StopWaveDataPlay", nullptr);
-	REGISTER_HANDLER(SDKLIB_PauseWaveDataPlay, HANDLE_NAMEONLY, "PauseWaveDataPlay", nullptr);
-	REGISTER_HANDLER(SDKLIB_ContinueWaveDataPlay, HANDLE_NAMEONLY, "ContinueWaveDataPlay", nullptr);
-	REGISTER_HANDLER(SDKLIB_RecordAdpcmEx, HANDLE_NAMEONLY, "RecordAdpcmEx", nullptr);
-	REGISTER_HANDLER(SDKLIB_StopADPCMRecord, HANDLE_NAMEONLY, "StopADPCMRecord", nullptr);
-	REGISTER_HANDLER(SDKLIB_IsWaveDataPlayStopped, HANDLE_NAMEONLY, "IsWaveDataPlayStopped", nullptr);
-	REGISTER_HANDLER(SDKLIB_PlayMP3Data, HANDLE_NAMEONLY, "PlayMP3Data", nullptr);
-	REGISTER_HANDLER(SDKLIB_StopMP3DataPlay, HANDLE_NAMEONLY, "StopMP3DataPlay", nullptr);
-	REGISTER_HANDLER(SDKLIB_PausePlayMP3Data, HANDLE_NAMEONLY, "PausePlayMP3Data", nullptr);
-	REGISTER_HANDLER(SDKLIB_ContinuePlayMP3Data, HANDLE_NAMEONLY, "ContinuePlayMP3Data", nullptr);
-	REGISTER_HANDLER(SDKLIB_InitBestlkHandle, HANDLE_NAMEONLY, "InitBestlkHandle", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetBestlkVoiceHandle, HANDLE_NAMEONLY, "SetBestlkVoiceHandle", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_RegistInputer, HANDLE_NAMEONLY, "IME_RegistInputer", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetLanguageAttr, HANDLE_NAMEONLY, "SetLanguageAttr", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetDialectAttr, HANDLE_NAMEONLY, "SetDialectAttr", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetLineEditorAttr, HANDLE_NAMEONLY, "SetLineEditorAttr", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetBookLibDataHFile, HANDLE_NAMEONLY, "SetBookLibDataHFile", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetBookVocLibDataHFile, HANDLE_NAMEONLY, "SetBookVocLibDataHFile", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_SetGlobalVar, HANDLE_NAMEONLY, "IME_SetGlobalVar", nullptr);
-	REGISTER_HANDLER(SDKLIB_IME_Functions, HANDLE_NAMEONLY, "IME_Functions", nullptr);
-	REGISTER_HANDLER(SDKLIB_LE_SupportMultiLangFunc, HANDLE_NAMEONLY, "LE_SupportMultiLangFunc", nullptr);
-	REGISTER_HANDLER(SDKLIB_ShowBookFromHANDLE, HANDLE_NAMEONLY, "ShowBookFromHANDLE", nullptr);
-	REGISTER_HANDLER(SDKLIB__wfnsplit, HANDLE_NAMEONLY, "_wfnsplit", nullptr);
-	REGISTER_HANDLER(SDKLIB__wfnmerge, HANDLE_NAMEONLY, "_wfnmerge", nullptr);
-	REGISTER_HANDLER(SDKLIB__wfcreate, HANDLE_NAMEONLY, "_wfcreate", nullptr);
-	REGISTER_HANDLER(SDKLIB__wfcreateSz, HANDLE_NAMEONLY, "_wfcreateSz", nullptr);
-	REGISTER_HANDLER(SDKLIB___wfopen, HANDLE_IMPLEMENTED, "__wfopen", __wfopen);
-	REGISTER_HANDLER(SDKLIB__wfindfirst, HANDLE_NAMEONLY, "_wfindfirst", _wfindfirst);
-	REGISTER_HANDLER(SDKLIB__wfindnext, HANDLE_NAMEONLY, "_wfindnext", _wfindnext);
-	REGISTER_HANDLER(SDKLIB__wfgetattr, HANDLE_NAMEONLY, "_wfgetattr", nullptr);
-	REGISTER_HANDLER(SDKLIB__wfsetattr, HANDLE_NAMEONLY, "_wfsetattr", nullptr);
-	REGISTER_HANDLER(SDKLIB___wremove, HANDLE_NAMEONLY, "__wremove", _wremove);
-	REGISTER_HANDLER(SDKLIB__wrename, HANDLE_NAMEONLY, "_wrename", nullptr);
-	REGISTER_HANDLER(SDKLIB__wfcopy, HANDLE_NAMEONLY, "_wfcopy", nullptr);
-	REGISTER_HANDLER(SDKLIB__wmkdir, HANDLE_NAMEONLY, "_wmkdir", _wmkdir);
-	REGISTER_HANDLER(SDKLIB__wrmdir, HANDLE_NAMEONLY, "_wrmdir", nullptr);
-	REGISTER_HANDLER(SDKLIB__wchdir, HANDLE_NAMEONLY, "_wchdir", _wchdir);
-	REGISTER_HANDLER(SDKLIB__wgetcurdir, HANDLE_NAMEONLY, "_wgetcurdir", nullptr);
-	REGISTER_HANDLER(SDKLIB__afsettime, HANDLE_NAMEONLY, "_afsettime", nullptr);
-	REGISTER_HANDLER(SDKLIB__wfsettime, HANDLE_NAMEONLY, "_wfsettime", nullptr);
-	REGISTER_HANDLER(SDKLIB__afullpath, HANDLE_NAMEONLY, "_afullpath", nullptr);
-	REGISTER_HANDLER(SDKLIB__wfullpath, HANDLE_NAMEONLY, "_wfullpath", nullptr);
-	REGISTER_HANDLER(SDKLIB_RunApplicationW, HANDLE_NAMEONLY, "RunApplicationW", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetApplicationNameW, HANDLE_NAMEONLY, "GetApplicationNameW", nullptr);
-	REGISTER_HANDLER(SDKLIB_LoadProgramW, HANDLE_NAMEONLY, "LoadProgramW", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetCurrentPathW, HANDLE_NAMEONLY, "GetCurrentPathW", nullptr);
-	REGISTER_HANDLER(SDKLIB_ProgramIsRunningW, HANDLE_NAMEONLY, "ProgramIsRunningW", nullptr);
-	REGISTER_HANDLER(SDKLIB_LoadHFileProgramW, HANDLE_NAMEONLY, "LoadHFileProgramW", nullptr);
-	REGISTER_HANDLER(SDKLIB_LoadHFileProgramA, HANDLE_NAMEONLY, "LoadHFileProgramA", nullptr);
-	REGISTER_HANDLER(SDKLIB__LoadLibraryA, HANDLE_IMPLEMENTED, "_LoadLibraryA", _LoadLibraryA);
-	REGISTER_HANDLER(SDKLIB__GetModuleFileNameA, HANDLE_NAMEONLY, "_GetModuleFileNameA", _GetModuleFileNameA);
-	REGISTER_HANDLER(SDKLIB__GetModuleHandleA, HANDLE_NAMEONLY, "_GetModuleHandleA", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetApplicationProcA, HANDLE_NAMEONLY, "GetApplicationProcA", nullptr);
-	REGISTER_HANDLER(SDKLIB_StayResidentProgramA, HANDLE_NAMEONLY, "StayResidentProgramA", nullptr);
-	REGISTER_HANDLER(SDKLIB_UnStayResidentProgramA, HANDLE_NAMEONLY, "UnStayResidentProgramA", nullptr);
-	REGISTER_HANDLER(SDKLIB_CheckProgramIsStayResident, HANDLE_NAMEONLY, "CheckProgramIsStayResident", nullptr);
-	REGISTER_HANDLER(SDKLIB__FindResourceA, HANDLE_NAMEONLY, "_FindResourceA", nullptr);
-	REGISTER_HANDLER(SDKLIB__FindResourceExA, HANDLE_NAMEONLY, "_FindResourceExA", nullptr);
-	REGISTER_HANDLER(SDKLIB__LoadLibraryW, HANDLE_NAMEONLY, "_LoadLibraryW", nullptr);
-	REGISTER_HANDLER(SDKLIB__GetModuleFileNameW, HANDLE_NAMEONLY, "_GetModuleFileNameW", nullptr);
-	REGISTER_HANDLER(SDKLIB__GetModuleHandleW, HANDLE_NAMEONLY, "_GetModuleHandleW", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetApplicationProcW, HANDLE_NAMEONLY, "GetApplicationProcW", nullptr);
-	REGISTER_HANDLER(SDKLIB__FindResourceW, HANDLE_IMPLEMENTED, "_FindResourceW", _FindResourceW);
-	REGISTER_HANDLER(SDKLIB__FindResourceExW, HANDLE_NAMEONLY, "_FindResourceExW", nullptr);
-	REGISTER_HANDLER(SDKLIB_StayResidentProgramW, HANDLE_NAMEONLY, "StayResidentProgramW", nullptr);
-	REGISTER_HANDLER(SDKLIB_UnStayResidentProgramW, HANDLE_NAMEONLY, "UnStayResidentProgramW", nullptr);
-	REGISTER_HANDLER(SDKLIB__FreeLibrary, HANDLE_IMPLEMENTED, "_FreeLibrary", _FreeLibrary);
-	REGISTER_HANDLER(SDKLIB__GetProcAddress, HANDLE_NAMEONLY, "_GetProcAddress", nullptr);
-	REGISTER_HANDLER(SDKLIB__SizeofResource, HANDLE_NAMEONLY, "_SizeofResource", nullptr);
-	REGISTER_HANDLER(SDKLIB__OpenResourceItemFile, HANDLE_NAMEONLY, "_OpenResourceItemFile", nullptr);
-	REGISTER_HANDLER(SDKLIB__CloseResourceItemFile, HANDLE_NAMEONLY, "_CloseResourceItemFile", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetCardSN, HANDLE_NAMEONLY, "GetCardSN", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetCardSize, HANDLE_NAMEONLY, "GetCardSize", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetThaiWord, HANDLE_NAMEONLY, "GetThaiWord", nullptr);
-	REGISTER_HANDLER(SDKLIB_LoadThaiGrammarLib, HANDLE_NAMEONLY, "LoadThaiGrammarLib", nullptr);
-	REGISTER_HANDLER(SDKLIB_FreeThaiGrammarLib, HANDLE_NAMEONLY, "FreeThaiGrammarLib", nullptr);
-	REGISTER_HANDLER(SDKLIB_WriteComDebugMsg, HANDLE_IMPLEMENTED, "WriteComDebugMsg", dbgMsg);
-	REGISTER_HANDLER(SDKLIB_CreateIconButton, HANDLE_NAMEONLY, "CreateIconButton", nullptr);
-	REGISTER_HANDLER(SDKLIB_LoadImageFile, HANDLE_NAMEONLY, "LoadImageFile", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetResourceCfg, HANDLE_NAMEONLY, "GetResourceCfg", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetSystemDefaultLangID, HANDLE_NAMEONLY, "GetSystemDefaultLangID", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetSystemDefaultLangID, HANDLE_NAMEONLY, "SetSystemDefaultLangID", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateFile, HANDLE_NAMEONLY, "CreateFile", CreateFile);
-	REGISTER_HANDLER(SDKLIB_DeleteFile, HANDLE_NAMEONLY, "DeleteFile", nullptr);
-	REGISTER_HANDLER(SDKLIB_ReadFile, HANDLE_NAMEONLY, "ReadFile", nullptr);
-	REGISTER_HANDLER(SDKLIB_WriteFile, HANDLE_NAMEONLY, "WriteFile", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetFilePointer, HANDLE_NAMEONLY, "SetFilePointer", nullptr);
-	REGISTER_HANDLER(SDKLIB_DeviceIoControl, HANDLE_NAMEONLY, "DeviceIoControl", DeviceIoControl);
-	REGISTER_HANDLER(SDKLIB_CloseHandle, HANDLE_NAMEONLY, "CloseHandle", CloseHandle);
-	REGISTER_HANDLER(SDKLIB_DictLastWord, HANDLE_NAMEONLY, "DictLastWord", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetTransBuffer, HANDLE_NAMEONLY, "GetTransBuffer", nullptr);
-	REGISTER_HANDLER(SDKLIB_DictIsYuanYinPhonetic, HANDLE_NAMEONLY, "DictIsYuanYinPhonetic", nullptr);
-	REGISTER_HANDLER(SDKLIB_InsertButtonTeam, HANDLE_NAMEONLY, "InsertButtonTeam", nullptr);
-	REGISTER_HANDLER(SDKLIB_CreateSearchInfo, HANDLE_NAMEONLY, "CreateSearchInfo", nullptr);
-	REGISTER_HANDLER(SDKLIB_FreeSearchInfo, HANDLE_NAMEONLY, "FreeSearchInfo", nullptr);
-	REGISTER_HANDLER(SDKLIB_DefProcessContent, HANDLE_NAMEONLY, "DefProcessContent", nullptr);
-	REGISTER_HANDLER(SDKLIB_DefInsertPic, HANDLE_NAMEONLY, "DefInsertPic", nullptr);
-	REGISTER_HANDLER(SDKLIB_DefGetWholeWord, HANDLE_NAMEONLY, "DefGetWholeWord", nullptr);
-	REGISTER_HANDLER(SDKLIB_DefAddALine, HANDLE_NAMEONLY, "DefAddALine", nullptr);
-	REGISTER_HANDLER(SDKLIB_PRICHVIEW_GetFlagLength, HANDLE_NAMEONLY, "PRICHVIEW_GetFlagLength", nullptr);
-	REGISTER_HANDLER(SDKLIB_PRICHVIEW_FilterMark, HANDLE_NAMEONLY, "PRICHVIEW_FilterMark", nullptr);
-	REGISTER_HANDLER(SDKLIB_AddNewWord, HANDLE_NAMEONLY, "AddNewWord", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetMaxSearchLayer, HANDLE_NAMEONLY, "GetMaxSearchLayer", nullptr);
-	REGISTER_HANDLER(SDKLIB_FormatMessage, HANDLE_NAMEONLY, "FormatMessage", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetFont, HANDLE_NAMEONLY, "SetFont", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetFont, HANDLE_NAMEONLY, "GetFont", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetFontWidth, HANDLE_NAMEONLY, "GetFontWidth", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetStringLengthEx, HANDLE_NAMEONLY, "GetStringLengthEx", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetFontStyle, HANDLE_NAMEONLY, "SetFontStyle", nullptr);
-	REGISTER_HANDLER(SDKLIB_RegisterUserFont, HANDLE_NAMEONLY, "RegisterUserFont", nullptr);
-	REGISTER_HANDLER(SDKLIB_UnRegisterUserFont, HANDLE_NAMEONLY, "UnRegisterUserFont", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetCurrentVideoDevice, HANDLE_NAMEONLY, "SetCurrentVideoDevice", nullptr);
-	REGISTER_HANDLER(SDKLIB_SetSupportDoubleLCD, HANDLE_NAMEONLY, "SetSupportDoubleLCD", nullptr);
-	REGISTER_HANDLER(SDKLIB__GetDriverType, HANDLE_NAMEONLY, "_GetDriverType", nullptr);
-	REGISTER_HANDLER(SDKLIB_EditControlFunc, HANDLE_NAMEONLY, "EditControlFunc", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetMasterSerialNumber, HANDLE_NAMEONLY, "GetMasterSerialNumber", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetMasterVendorInfo, HANDLE_NAMEONLY, "GetMasterVendorInfo", nullptr);
-	REGISTER_HANDLER(SDKLIB_PRICHVIEW_SetDisplayPosition, HANDLE_NAMEONLY, "PRICHVIEW_SetDisplayPosition", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetApplicationHeadInfoA, HANDLE_NAMEONLY, "GetApplicationHeadInfoA", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetApplicationHeadInfoW, HANDLE_NAMEONLY, "GetApplicationHeadInfoW", nullptr);
-	REGISTER_HANDLER(SDKLIB__FreeFindResInfo, HANDLE_NAMEONLY, "_FreeFindResInfo", nullptr);
-	REGISTER_HANDLER(SDKLIB_GetWholeWord, HANDLE_NAMEONLY, "GetWholeWord", nullptr);
-	REGISTER_HANDLER(SDKLIB_LoadWordGrammarLib, HANDLE_NAMEONLY, "LoadWordGrammarLib", nullptr);
-	REGISTER_HANDLER(SDKLIB_FreeWordGrammarLib, HANDLE_NAMEONLY, "FreeWordGrammarLib", nullptr);
-	REGISTER_HANDLER(SDKLIB_mount_file_disk, HANDLE_NAMEONLY, "mount_file_disk", nullptr);
-	REGISTER_HANDLER(SDKLIB_umount_file_disk, HANDLE_NAMEONLY, "umount_file_disk", nullptr);
-	REGISTER_HANDLER(SDKLIB___close, HANDLE_NAMEONLY, "__close", nullptr);
-	REGISTER_HANDLER(SDKLIB___commit, HANDLE_NAMEONLY, "__commit", nullptr);
-	REGISTER_HANDLER(SDKLIB___creat, HANDLE_NAMEONLY, "__creat", nullptr);
-	REGISTER_HANDLER(SDKLIB___dup, HANDLE_NAMEONLY, "__dup", nullptr);
-	REGISTER_HANDLER(SDKLIB___wcreat, HANDLE_NAMEONLY, "__wcreat", nullptr);
-	REGISTER_HANDLER(SDKLIB___eof, HANDLE_NAMEONLY, "__eof", nullptr);
-	REGISTER_HANDLER(SDKLIB___get_errno, HANDLE_NAMEONLY, "__get_errno", nullptr);
-	REGISTER_HANDLER(SDKLIB___lseek, HANDLE_NAMEONLY, "__lseek", nullptr);
-	REGISTER_HANDLER(SDKLIB___lseeki64, HANDLE_NAMEONLY, "__lseeki64", nullptr);
-	REGISTER_HANDLER(SDKLIB___open, HANDLE_NAMEONLY, "__open", nullptr);
-	REGISTER_HANDLER(SDKLIB___wopen, HANDLE_NAMEONLY, "__wopen", nullptr);
-	REGISTER_HANDLER(SDKLIB___read, HANDLE_NAMEONLY, "__read", nullptr);
-	REGISTER_HANDLER(SDKLIB___set_errno, HANDLE_NAMEONLY, "__set_errno", nullptr);
-	REGISTER_HANDLER(SDKLIB___tell, HANDLE_NAMEONLY, "__tell", nullptr);
-	REGISTER_HANDLER(SDKLIB___telli64, HANDLE_NAMEONLY, "__telli64", nullptr);
-	REGISTER_HANDLER(SDKLIB___truncate, HANDLE_NAMEONLY, "__truncate", nullptr);
-	REGISTER_HANDLER(SDKLIB___write, HANDLE_NAMEONLY, "__write", nullptr);
-	REGISTER_HANDLER(SDKLIB__MultiByteToWideChar, HANDLE_NAMEONLY, "_MultiByteToWideChar", nullptr);
-	REGISTER_HANDLER(SDKLIB__WideCharToMultiByte, HANDLE_NAMEONLY, "_WideCharToMultiByte", nullptr);
+	for (uint32_t i = 0; i < std::size(s_sdklibHandlers); i++) {
+		if (s_sdklibHandlers[i].Id != SDKLIB_FIRST + i)
+			return false;
+	}
+	return true;
+}
+
+static_assert(std::size(s_sdklibHandlers) == SDKLIB_LAST - SDKLIB_FIRST + 1, "SDKLIB handler table must cover every SDKLIB ID");
+static_assert(IsDenseHandlerTable(), "SDKLIB handler table must be ordered by ID without gaps");
 
+SystemAPI::SystemAPI()
+{
 	sys_init();
 }
 
-void SystemAPI::RegisterHandler(InterruptHandler* handler)
+const InterruptHandler* SystemAPI::FindHandler(InterruptID id) const
 {
-	if (handler == nullptr)
-		return;
+	uint32_t index = static_cast<uint32_t>(id) - SDKLIB_FIRST;
+	// Every known service is an SDKLIB ID; anything else is reported as undefined
+	return index < std::size(s_sdklibHandlers) ? &s_sdklibHandlers[index] : nullptr;
+}
 
-	_handlers[handler->Id] = handler;
+SystemCallStats& SystemAPI::StatsFor(InterruptID id)
+{
+	uint32_t index = static_cast<uint32_t>(id) - SDKLIB_FIRST;
+	SystemCallStats& stats = index < std::size(_sdklibStats) ? _sdklibStats[index] : _extraStats[id];
+	if (stats.Count == 0) {
+		const InterruptHandler* handler = FindHandler(id);
+		stats.Id = id;
+		stats.Name = handler ? handler->Name : "UNDEFINED";
+	}
+	return stats;
 }
 
+uint32_t SystemAPI::Call(InterruptID id, const SystemCallFrame& frame)
+{
+	_callCount++;
+
+	SystemCallStats& stats = StatsFor(id);
+	_currentStats = &stats;
+
+	auto start = std::chrono::steady_clock::now();
+	uint32_t ret = Dispatch(FindHandler(id), id, frame);
+	uint64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+	_currentStats = nullptr;
+	stats.Count++;
+	stats.TotalNs += elapsed;
+	if (elapsed > stats.MaxNs)
+		stats.MaxNs = elapsed;
+	return ret;
+}
+
+std::vector<SystemCallStats> SystemAPI::SnapshotStats() const
+{
+	std::vector<SystemCallStats> snapshot;
+	for (const auto& stats : _sdklibStats) {
+		if (stats.Count)
+			snapshot.push_back(stats);
+	}
+	for (const auto& [id, stats] : _extraStats) {
+		if (stats.Count)
+			snapshot.push_back(stats);
+	}
+	return snapshot;
+}
+
+void SystemAPI::DumpStats(FILE* out) const
+{
+	auto snapshot = SnapshotStats();
+	std::sort(snapshot.begin(), snapshot.end(), [](const SystemCallStats& a, const SystemCallStats& b) { return a.TotalNs > b.TotalNs; });
+
+	fprintf(out, "\n%-7s %-32s %12s %12s %10s %10s %14s\n", "ID", "Name", "Calls", "Total ms", "Avg us", "Max us", "Bytes");
+	for (const auto& stats : snapshot) {
+		fprintf(out, "%05X   %-32s %12llu %12.3f %10.3f %10.3f %14llu\n", stats.Id, stats.Name, stats.Count,
+			stats.TotalNs / 1e6, stats.TotalNs / 1e3 / stats.Count, stats.MaxNs / 1e3, stats.Bytes);
+	}
+}
 
-uint32_t SystemAPI::Call(InterruptID id, SystemServiceArguments args)
+uint32_t SystemAPI::Dispatch(const InterruptHandler* _handle, InterruptID id, const SystemCallFrame& frame)
 {
-	auto _handler = _handlers.find(id);
-	if (_handler != _handlers.end()) {
-		auto _handle = _handler->second;
+	if (_handle) {
+		if (_handle->Bound)
+			return _handle->Bound(frame);
 
+		SystemServiceArguments args(frame);
 		if (_handle->Callback) {
 			//printf("[%05X] %s() called by thread [%i]\n", _handle->Id, _handle->Name, sThreadHandler->GetCurrentThreadId());
 			//printf("    r0: %08X|%i\n    r1: %08X|%i\n    r2: %08X|%i\n    r3: %08X|%i\n    r4: %08X|%i\n    sp: %08X\n", args.r0, args.r0, args.r1,
@@ -6,12 +6,37 @@
 #include "interrupts.h"
 #include "InterruptHandler.h"
 
+#include <cstdio>
+#include <vector>
+
+// Per-service counters, kept for every dispatched ID
+struct SystemCallStats
+{
+    InterruptID Id;
+    const char* Name;
+    uint64_t Count;
+    uint64_t TotalNs;   // host time spent in the handler
+    uint64_t MaxNs;
+    uint64_t Bytes;     // data moved by I/O handlers, see AddBytesTransferred
+};
+
 class SystemAPI
 {
 public:
     static SystemAPI* GetInstance() { return !_instance ? _instance = new SystemAPI : _instance; }
 
-    uint32_t Call(InterruptID id, SystemServiceArguments args);
+    uint32_t Call(InterruptID id, const SystemCallFrame& frame);
+
+    // Number of system calls dispatched so far
+    uint64_t GetCallCount() const { return _callCount; }
+
+    // Called by I/O handlers; the bytes are attributed to the system call being dispatched
+    void AddBytesTransferred(size_t bytes) { if (_currentStats) _currentStats->Bytes += bytes; }
+    // Services called at least once. Counters are owned by the emulator thread: call this from it
+    // (see Executor::RequestStats) or once Execute has returned.
+    std::vector<SystemCallStats> SnapshotStats() const;
+    // Prints the snapshot sorted by total host time
+    void DumpStats(FILE* out) const;
 
 private:
     SystemAPI();
@@ -20,9 +45,15 @@ private:
     void operator=(SystemAPI const&) = delete;
     static SystemAPI* _instance;
 
-    std::map<InterruptID, InterruptHandler*> _handlers;
+    uint64_t _callCount = 0;
+
+    SystemCallStats _sdklibStats[SDKLIB_LAST - SDKLIB_FIRST + 1] = {};
+    std::map<InterruptID, SystemCallStats> _extraStats;
+    SystemCallStats* _currentStats = nullptr;
 
-    void RegisterHandler(InterruptHandler* handler);
+    const InterruptHandler* FindHandler(InterruptID id) const;
+    SystemCallStats& StatsFor(InterruptID id);
+    uint32_t Dispatch(const InterruptHandler* handler, InterruptID id, const SystemCallFrame& frame);
 };
 
 
@@ -0,0 +1,103 @@
+#ifndef SYSTEMCALLBINDING_H
+#define SYSTEMCALLBINDING_H
+
+#include "InterruptHandler.h"
+#include "MemoryManager.h"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// Guest pointer argument/return value. Holds the guest address and resolves it to host memory on use.
+template <typename T>
+struct GuestPtr
+{
+    VirtPtr addr;
+
+    T* get() const { return addr ? reinterpret_cast<T*>(sMemoryManager->GetRealAddr(addr)) : nullptr; }
+    operator T*() const { return get(); }
+    T* operator->() const { return get(); }
+};
+
+// Typed handle arguments; kept as distinct names so handler signatures document what they take
+typedef uint32_t FileHandle;
+typedef uint32_t DeviceHandle;
+
+namespace SystemCallBinding
+{
+    // AAPCS: the first four words go in r0-r3, the rest on the stack. The SVC stub pushes
+    // two words before trapping, so stack argument N (N >= 4) lives at sp + 8 + 4 * (N - 4).
+    constexpr size_t REGISTER_ARGS = 4;
+    constexpr uint32_t STACK_ARGS_OFFSET = 8;
+
+    template <typename T>
+    struct Argument
+    {
+        static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "system call arguments must be 32-bit integers, enums or GuestPtr");
+        static_assert(sizeof(T) <= sizeof(uint32_t), "64-bit system call arguments are not supported");
+        static T Decode(uint32_t raw) { return static_cast<T>(raw); }
+    };
+
+    template <typename T>
+    struct Argument<GuestPtr<T>>
+    {
+        static GuestPtr<T> Decode(uint32_t raw) { return GuestPtr<T>{ raw }; }
+    };
+
+    template <typename R>
+    struct Result
+    {
+        static uint32_t Encode(R value) { return static_cast<uint32_t>(value); }
+    };
+
+    template <typename T>
+    struct Result<GuestPtr<T>>
+    {
+        static uint32_t Encode(GuestPtr<T> value) { return value.addr; }
+    };
+
+    template <size_t Count>
+    void ReadArguments(const SystemCallFrame& frame, uint32_t* raw)
+    {
+        constexpr size_t inRegisters = Count < REGISTER_ARGS ? Count : REGISTER_ARGS;
+        if constexpr (inRegisters > 0) {
+            static const int regs[REGISTER_ARGS] = { UC_ARM_REG_R0, UC_ARM_REG_R1, UC_ARM_REG_R2, UC_ARM_REG_R3 };
+            void* values[inRegisters];
+            for (size_t i = 0; i < inRegisters; i++)
+                values[i] = &raw[i];
+            uc_reg_read_batch(frame.uc, const_cast<int*>(regs), values, inRegisters);
+        }
+        if constexpr (Count > REGISTER_ARGS) {
+            const uint32_t* stack = reinterpret_cast<const uint32_t*>(sMemoryManager->GetRealAddr(frame.sp + STACK_ARGS_OFFSET));
+            for (size_t i = REGISTER_ARGS; i < Count; i++)
+                raw[i] = stack ? stack[i - REGISTER_ARGS] : 0;
+        }
+    }
+
+    template <typename R, typename... Args, size_t... I>
+    uint32_t Invoke(R(*fn)(Args...), const SystemCallFrame& frame, std::index_sequence<I...>)
+    {
+        uint32_t raw[sizeof...(Args) > 0 ? sizeof...(Args) : 1];
+        ReadArguments<sizeof...(Args)>(frame, raw);
+
+        if constexpr (std::is_void_v<R>) {
+            fn(Argument<std::decay_t<Args>>::Decode(raw[I])...);
+            return 0;
+        }
+        else
+            return Result<R>::Encode(fn(Argument<std::decay_t<Args>>::Decode(raw[I])...));
+    }
+
+    template <typename R, typename... Args>
+    constexpr size_t Arity(R(*)(Args...)) { return sizeof...(Args); }
+}
+
+// Adapts a typed handler, e.g. uint32_t _fread(GuestPtr<void>, uint32_t, uint32_t, FileHandle),
+// to the dispatch table. Only the registers and stack words the signature names are read.
+template <auto Fn>
+uint32_t Bind(const SystemCallFrame& frame)
+{
+    return SystemCallBinding::Invoke(Fn, frame, std::make_index_sequence<SystemCallBinding::Arity(Fn)>{});
+}
+
+#endif
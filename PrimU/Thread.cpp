@@ -1,11 +1,15 @@
 #include "Thread.h"
 #include "ThreadHandler.h"
+#include "Snapshot.h"
+
+#include <algorithm>
+
+// Ids are never reused; a restored snapshot moves the counter past its threads
+static int g_nextThreadId = 0;
 
 int Thread::GenerateUniqueId()
 {
-    static int currentInt = -1;
-    currentInt++;
-    return currentInt;
+    return g_nextThreadId++;
 }
 
 void Thread::LoadState()
@@ -25,11 +29,10 @@ void Thread::SaveState()
 
 void ThreadState::LoadState()
 {
-    if (!_isNewThread) {
-        uc_context_restore(sExecutor->GetUcInstance(), _state);
-    }
-
-    uc_reg_write_batch(sExecutor->GetUcInstance(), reinterpret_cast<int*>(_regs), reinterpret_cast<void**>(_args), 16);
+    // A thread that never ran has no CPSR of its own yet and inherits the current mode; the T bit
+    // then follows bit 0 of its entry point.
+    int first = _isNewThread ? REG_R0 : REG_CPSR;
+    uc_reg_write_batch(sExecutor->GetUcInstance(), const_cast<int*>(_regs + first), _ptrs + first, REG_COUNT - first);
 }
 
 /*
@@ -39,15 +42,95 @@ void ThreadState::LoadState()
 */
 void ThreadState::SaveState()
 {
-    uc_context_save(sExecutor->GetUcInstance(), _state);
-    uc_reg_read_batch(sExecutor->GetUcInstance(), reinterpret_cast<int*>(_regs), reinterpret_cast<void**>(_args), 16);
+    uc_reg_read_batch(sExecutor->GetUcInstance(), const_cast<int*>(_regs), _ptrs, REG_COUNT);
+
+    // Keep the Thumb state in bit 0 of the resume address, as a PC write restores it from there
+    if (_values[REG_CPSR] & CPSR_THUMB)
+        _values[REG_PC] |= 1;
+
+    _isNewThread = false;
+}
+
+void ThreadState::SaveSnapshot(SnapshotWriter& writer) const
+{
+    writer.WriteBytes(_values, sizeof(_values));
+    writer.Write<uint8_t>(_isNewThread);
+}
+
+void ThreadState::RestoreSnapshot(SnapshotReader& reader)
+{
+    reader.ReadBytes(_values, sizeof(_values));
+    _isNewThread = reader.Read<uint8_t>() != 0;
+}
+
+Thread::Thread(SnapshotReader& reader)
+{
+    _id = reader.Read<int32_t>();
+    g_nextThreadId = std::max(g_nextThreadId, _id + 1);
+    _priority = reader.Read<uint8_t>();
+    _stackSize = reader.Read<uint32_t>();
+    _stackAddr = reader.Read<uint32_t>();
+    _schedState = static_cast<SchedState>(reader.Read<uint8_t>());
+    _readySince = reader.ReadTime();
+
+    _state = new ThreadState(0, 0, 0);
+    _state->RestoreSnapshot(reader);
+
+    // Critical sections and events were restored first; they are referenced by their guest keys
+    if (uint32_t key = reader.Read<uint32_t>())
+        _requested = FindSnapshotCriticalSection(key);
+    uint32_t ownedCount = reader.Read<uint32_t>();
+    for (uint32_t i = 0; i < ownedCount && reader.Ok(); i++) {
+        CriticalSection* cs = FindSnapshotCriticalSection(reader.Read<uint32_t>());
+        int count = reader.Read<int32_t>();
+        if (cs)
+            _ownedCriticalSections[cs] = count;
+        else
+            reader.Fail("thread owns an unknown critical section");
+    }
 
-    size_t thumb;
-    uc_query(sExecutor->GetUcInstance(), UC_QUERY_MODE, &thumb);
-    _pc += (thumb & UC_MODE_THUMB) ? 1 : 0;
+    if (uint32_t eventId = reader.Read<uint32_t>()) {
+        _waitingEvent = FindSnapshotEvent(eventId);
+        if (!_waitingEvent)
+            reader.Fail("thread waits on an unknown event");
+    }
+    _waitTimeoutEnd = reader.ReadTime();
+    _waitingInfinite = reader.Read<uint8_t>() != 0;
 
-    if (_isNewThread)
-        _isNewThread = false;
+    _suspendCount = reader.Read<int32_t>();
+    _isSuspended = reader.Read<uint8_t>() != 0;
+
+    _sleepEnd = reader.ReadTime();
+    _isSleeping = reader.Read<uint8_t>() != 0;
+}
+
+void Thread::SaveSnapshot(SnapshotWriter& writer) const
+{
+    writer.Write<int32_t>(_id);
+    writer.Write<uint8_t>(_priority);
+    writer.Write<uint32_t>(static_cast<uint32_t>(_stackSize));
+    writer.Write<uint32_t>(_stackAddr);
+    writer.Write<uint8_t>(static_cast<uint8_t>(_schedState));
+    writer.WriteTime(_readySince);
+
+    _state->SaveSnapshot(writer);
+
+    writer.Write<uint32_t>(_requested ? GetSnapshotCriticalSectionKey(_requested) : 0);
+    writer.Write<uint32_t>(static_cast<uint32_t>(_ownedCriticalSections.size()));
+    for (auto& [cs, count] : _ownedCriticalSections) {
+        writer.Write<uint32_t>(GetSnapshotCriticalSectionKey(cs));
+        writer.Write<int32_t>(count);
+    }
+
+    writer.Write<uint32_t>(_waitingEvent ? GetSnapshotEventId(_waitingEvent) : 0);
+    writer.WriteTime(_waitTimeoutEnd);
+    writer.Write<uint8_t>(_waitingInfinite);
+
+    writer.Write<int32_t>(_suspendCount);
+    writer.Write<uint8_t>(_isSuspended);
+
+    writer.WriteTime(_sleepEnd);
+    writer.Write<uint8_t>(_isSleeping);
 }
 
 
@@ -58,6 +141,11 @@ uint32_t Thread::GetTimeQuantum()
     return 400 - _priority;
 }
 
+uint64_t Thread::GetInstructionQuantum()
+{
+    return static_cast<uint64_t>(GetTimeQuantum()) * THREAD_INS;
+}
+
 
 // ʵ  ˡFIFO ȴУͷʱȨֱ transfer 
 void Thread::EnterCriticalSection(CriticalSection* criticalSection)
@@ -142,6 +230,7 @@ void Thread::LeaveCriticalSection(CriticalSection* criticalSection)
             //  next ־ next ĳбм¼ѻø CS
             next->_requested = nullptr;
             next->_ownedCriticalSections[criticalSection] = 1;
+            sThreadHandler->ReadyThread(next);
         }
         else {
             // ޵ȴߣͷٽ
@@ -182,6 +271,7 @@ void Thread::SetEvent(Event* ev)
             // ȴ״̬ʹ߳´εȿУCanRun ῴ _waitingEvent == nullptr
             t->_waitingEvent = nullptr;
             t->_waitingInfinite = false;
+            sThreadHandler->ReadyThread(t);
             // t->_waitTimeoutEnd Ҫרãȴ־
         }
     }
@@ -195,6 +285,7 @@ void Thread::SetEvent(Event* ev)
             // transfer ownership: ̵߳ȴ־
             t->_waitingEvent = nullptr;
             t->_waitingInfinite = false;
+            sThreadHandler->ReadyThread(t);
 
             // Ensure signaled stays false (auto consumed)
             ev->signaled = false;
@@ -245,11 +336,11 @@ void Thread::WaitForEvent(Event* ev, int timeoutMillis)
     _waitingInfinite = (timeoutMillis < 0);
 
     if (!_waitingInfinite) {
-        _waitTimeoutEnd = std::chrono::high_resolution_clock::now() + std::chrono::milliseconds(timeoutMillis);
+        _waitTimeoutEnd = GuestClock::now() + std::chrono::milliseconds(timeoutMillis);
     }
     else {
         // set to a sentinel (not strictly necessary)
-        _waitTimeoutEnd = std::chrono::high_resolution_clock::time_point::max();
+        _waitTimeoutEnd = GuestClock::time_point::max();
     }
 
     // Non-blocking: غ̴߳ڵȴ״̬ CanRun() ֱ¼ʱ Resume
@@ -270,6 +361,7 @@ void Thread::Resume()
     if (_suspendCount > 0) --_suspendCount;
     if (_suspendCount == 0) {
         _isSuspended = false;
+        sThreadHandler->ReadyThread(this);
     }
     // ߳ڵȴ¼ٽڱ ResumeCanRun() Ƿ
 }
@@ -289,6 +381,17 @@ static void remove_from_event_waiters(Event* ev, Thread* t)
     }
 }
 
+void Thread::Wake(Event* ev)
+{
+    if (ev == nullptr || _waitingEvent != ev)
+        return;
+
+    remove_from_event_waiters(_waitingEvent, this);
+    _waitingEvent = nullptr;
+    _waitingInfinite = false;
+    sThreadHandler->ReadyThread(this);
+}
+
 // ================================
 // ޸İ CanRun()  ¼ȴ suspend ж
 // ================================
@@ -300,7 +403,7 @@ bool Thread::CanRun()
 
     // 2) ˯߼У
     if (_isSleeping) {
-        if (_sleepEnd > std::chrono::high_resolution_clock::now())
+        if (_sleepEnd > GuestClock::now())
             return false;
         _isSleeping = false;
     }
@@ -345,7 +448,7 @@ bool Thread::CanRun()
 
         // 鳬ʱ
         if (!_waitingInfinite) {
-            auto now = std::chrono::high_resolution_clock::now();
+            auto now = GuestClock::now();
             if (now >= _waitTimeoutEnd) {
                 // ʱ¼ƳԼȴ־ؿ
                 remove_from_event_waiters(ev, this);
@@ -362,8 +465,26 @@ bool Thread::CanRun()
     // 5) û߳̿
     return true;
 }
+bool Thread::GetWakeDeadline(GuestClock::time_point* deadline) const
+{
+    if (_isSuspended || _requested != nullptr)
+        return false;
+
+    if (_isSleeping) {
+        *deadline = _sleepEnd;
+        return true;
+    }
+
+    if (_waitingEvent != nullptr && !_waitingInfinite) {
+        *deadline = _waitTimeoutEnd;
+        return true;
+    }
+
+    return false;
+}
+
 void Thread::Sleep(uint32_t time)
 {
     _isSleeping = true;
-    _sleepEnd = std::chrono::high_resolution_clock::now() + std::chrono::milliseconds(time);
+    _sleepEnd = GuestClock::now() + std::chrono::milliseconds(time);
 }
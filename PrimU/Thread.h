@@ -2,52 +2,55 @@
 #define THREAD_H
 
 #include "executor.h"
+#include "GuestClock.h"
 #include <chrono>
 
+class SnapshotWriter;
+class SnapshotReader;
+
+// Guest register file of a descheduled thread. R0-R15 plus CPSR is the whole user-visible state of the
+// ARM926 (no VFP), so a switch is one batched read and one batched write instead of a full uc_context.
 class ThreadState
 {
 public:
-    ThreadState(VirtPtr startPtr, VirtPtr stackPtr, uint32_t arg) :_r0(arg), _sp(stackPtr), _pc(startPtr)
+    ThreadState(VirtPtr startPtr, VirtPtr stackPtr, uint32_t arg)
     {
-        uc_context_alloc(sExecutor->GetUcInstance(), &_state);
+        _values[REG_R0] = arg;
+        _values[REG_SP] = stackPtr;
+        _values[REG_PC] = startPtr;
     }
-
-    ~ThreadState() { uc_free(&_state); }
+    // _ptrs points into this object's own _values, so a copy would alias the original's registers
+    ThreadState(ThreadState const&) = delete;
+    void operator=(ThreadState const&) = delete;
 
     void LoadState();
     void SaveState();
-    uint32_t GetCurrentAddr() const { return _pc; }
+    uint32_t GetCurrentAddr() const { return _values[REG_PC]; }
+    void SetCurrentAddr(uint32_t addr) { _values[REG_PC] = addr; }
+
+    void SaveSnapshot(SnapshotWriter& writer) const;
+    void RestoreSnapshot(SnapshotReader& reader);
 private:
-    uint32_t _r0 = 0;
-    uint32_t _r1 = 0;
-    uint32_t _r2 = 0;
-    uint32_t _r3 = 0;
-    uint32_t _r4 = 0;
-    uint32_t _r5 = 0;
-    uint32_t _r6 = 0;
-    uint32_t _r7 = 0;
-    uint32_t _r8 = 0;
-    uint32_t _r9 = 0;
-    uint32_t _r10 = 0;
-    uint32_t _r11 = 0;
-    uint32_t _r12 = 0;
-    uint32_t _sp = 0;
-    uint32_t _pc = 0;
-    uint32_t _lr = 0;
-
-    uc_context* _state;
-    bool _isNewThread = true;
+    enum : int { REG_CPSR = 0, REG_R0 = 1, REG_SP = 14, REG_LR = 15, REG_PC = 16, REG_COUNT = 17 };
 
-    uc_arm_reg _regs[16] =
+    // CPSR leads so the mode and T bit are in place before the banked registers and PC are written
+    static constexpr int _regs[REG_COUNT] =
     {
+        UC_ARM_REG_CPSR,
         UC_ARM_REG_R0, UC_ARM_REG_R1, UC_ARM_REG_R2, UC_ARM_REG_R3,
         UC_ARM_REG_R4, UC_ARM_REG_R5, UC_ARM_REG_R6, UC_ARM_REG_R7,
         UC_ARM_REG_R8, UC_ARM_REG_R9, UC_ARM_REG_R10, UC_ARM_REG_R11,
         UC_ARM_REG_R12, UC_ARM_REG_SP, UC_ARM_REG_LR, UC_ARM_REG_PC
     };
 
-    void* _args[16] = { &_r0, &_r1, &_r2, &_r3, &_r4, &_r5, &_r6, &_r7, &_r8, &_r9, &_r10, &_r11, &_r12, &_sp, &_lr, &_pc };
-
+    uint32_t _values[REG_COUNT] = {};
+    void* _ptrs[REG_COUNT] =
+    {
+        &_values[0], &_values[1], &_values[2], &_values[3], &_values[4], &_values[5],
+        &_values[6], &_values[7], &_values[8], &_values[9], &_values[10], &_values[11],
+        &_values[12], &_values[13], &_values[14], &_values[15], &_values[16]
+    };
+    bool _isNewThread = true;
 };
 
 struct CriticalSection;
@@ -55,17 +58,16 @@ struct CriticalSection;
 class Thread
 {
 public:
-    Thread(Thread** currentThread, VirtPtr start, uint32_t arg, uint8_t priority, size_t stackSize) :_id(GenerateUniqueId())
+    // Where the scheduler currently keeps the thread; only StateManager changes it
+    enum SchedState
     {
-        if (*currentThread == nullptr) {
-            SetNextThread(this);
-            *currentThread = this;
-        }
-        else {
-            SetNextThread((*currentThread)->GetNextThread());
-            (*currentThread)->SetNextThread(this);
-        }
+        SCHED_RUNNING,
+        SCHED_READY,
+        SCHED_BLOCKED
+    };
 
+    Thread(VirtPtr start, uint32_t arg, uint8_t priority, size_t stackSize) :_id(GenerateUniqueId())
+    {
         if (stackSize != 0)
             _stackSize = stackSize;
 
@@ -80,18 +82,24 @@ public:
         _requested = nullptr;
     }
 
+    // Rebuilds a thread from a machine snapshot; its stack is part of the restored heap
+    explicit Thread(SnapshotReader& reader);
+
     ~Thread()
     {
-        sMemoryManager->DynamicFree(_stackAddr);
+        if (_stackAddr)
+            sMemoryManager->DynamicFree(_stackAddr);
         delete _state;
     }
 
-    void SetNextThread(Thread* nextThread) { _nextThread = nextThread; }
-    Thread* GetNextThread() const { return _nextThread; }
+    // The stack stays allocated when the thread is deleted; for when guest memory is replaced as a whole
+    void AbandonStack() { _stackAddr = 0; }
 
     void SaveState();
     void LoadState();
 
+    void SaveSnapshot(SnapshotWriter& writer) const;
+
     void EnterCriticalSection(CriticalSection* criticalSection);
     void LeaveCriticalSection(CriticalSection* criticalSection);
 
@@ -100,7 +108,9 @@ public:
     void SetPriority(uint8_t priority) { _priority = priority; }
 
     uint32_t GetTimeQuantum();
+    uint64_t GetInstructionQuantum();
     uint32_t GetCurrentPC() const { return _state->GetCurrentAddr(); }
+    void SetCurrentPC(uint32_t pc) { _state->SetCurrentAddr(pc); }
     uint8_t GetPriority() const { return _priority; }
 
     // Event API
@@ -113,9 +123,21 @@ public:
     void Suspend();
     void Resume();
 
+    // Ends a wait on `ev` early, as if it timed out; used when host input arrives for a parked UI
+    // thread. A wait on any other event is left alone.
+    void Wake(Event* ev);
+
     bool CanRun();
     int GetId() const { return _id; }
 
+    // Earliest time a blocked thread may become runnable on its own (sleep end or wait timeout)
+    bool GetWakeDeadline(GuestClock::time_point* deadline) const;
+
+    SchedState GetSchedState() const { return _schedState; }
+    void SetSchedState(SchedState state) { _schedState = state; }
+    GuestClock::time_point GetReadySince() const { return _readySince; }
+    void SetReadySince(GuestClock::time_point time) { _readySince = time; }
+
 private:
     static int GenerateUniqueId();
 
@@ -126,18 +148,19 @@ private:
     size_t _stackSize = 0x2000;
     VirtPtr _stackAddr;
 
-    Thread* _nextThread;
+    SchedState _schedState = SCHED_READY;
+    GuestClock::time_point _readySince;
     CriticalSection* _requested = nullptr;
     std::unordered_map<CriticalSection*, int> _ownedCriticalSections;
 
     Event* _waitingEvent = nullptr; // ǰڵȴ¼ nullptr
-    std::chrono::high_resolution_clock::time_point _waitTimeoutEnd;
+    GuestClock::time_point _waitTimeoutEnd;
     bool _waitingInfinite = false;  // timeout < 0 ʾ޵ȴ
 
     int _suspendCount = 0;      // Ƕ suspend ļ
     bool _isSuspended = false;
 
-    std::chrono::high_resolution_clock::time_point _sleepEnd;
+    GuestClock::time_point _sleepEnd;
     bool _isSleeping = false;
 };
 
@@ -2,12 +2,25 @@
 
 #include "ThreadHandler.h"
 #include "Thread.h"
+#include "Snapshot.h"
+
+#include <chrono>
+#include <algorithm>
 
 StateManager* StateManager::_instance = nullptr;
 
 int StateManager::NewThread(VirtPtr start, uint32_t arg, uint8_t priority, size_t stackSize)
 {
-	Thread* newThread = new Thread(&_currentThread, start, arg, priority, stackSize);
+	Thread* newThread = new Thread(start, arg, priority, stackSize);
+	_threads.push_back(newThread);
+
+	if (_currentThread == nullptr) {
+		newThread->SetSchedState(Thread::SCHED_RUNNING);
+		_currentThread = newThread;
+	}
+	else
+		EnqueueReady(newThread);
+
 	return newThread->GetId();
 }
 
@@ -35,43 +48,303 @@ uint32_t StateManager::GetCurrentThreadPC()
 	return 0;
 }
 
+void StateManager::SetCurrentThreadPC(uint32_t pc)
+{
+	if (_currentThread)
+		_currentThread->SetCurrentPC(pc);
+}
+
 void StateManager::SwitchThread()
 {
+	Thread* previous = _currentThread;
+	Thread* yielded = yielding ? previous : nullptr;
+	yielding = false;
 
-	if (_currentThread != _currentThread->GetNextThread()) {
-		_currentThread = _currentThread->GetNextThread();
-		_currentThread->LoadState();
+	if (!_idle) {
+		if (previous->CanRun())
+			EnqueueReady(previous);
+		else
+			Park(previous);
+	}
+
+	DrainWakeRequests();
+	ExpireTimers();
+
+	Thread* next = PickNext(yielded);
+	if (next == nullptr) {
+		// Everything is blocked; the previous thread stays current but parked until something wakes
+		_idle = true;
+		return;
+	}
+
+	_idle = false;
+	next->SetSchedState(Thread::SCHED_RUNNING);
+	_currentThread = next;
+	if (next != previous) {
+		next->LoadState();
+		_switchCount++;
 	}
 }
 
+void StateManager::EnqueueReady(Thread* thread)
+{
+	thread->SetSchedState(Thread::SCHED_READY);
+	thread->SetReadySince(GuestClock::now());
+	_readyQueues[thread->GetPriority()].push_back(thread);
+}
 
-int StateManager::SetThreadPriority(int threadId, uint8_t priority)
+void StateManager::RemoveReady(Thread* thread)
+{
+	auto queue = _readyQueues.find(thread->GetPriority());
+	if (queue == _readyQueues.end())
+		return;
+
+	auto it = std::find(queue->second.begin(), queue->second.end(), thread);
+	if (it != queue->second.end())
+		queue->second.erase(it);
+	if (queue->second.empty())
+		_readyQueues.erase(queue);
+}
+
+void StateManager::Park(Thread* thread)
 {
-	for (Thread* thread = nullptr; thread != _currentThread; thread = thread->GetNextThread()) {
-		if (thread == nullptr)
-			thread = _currentThread;
+	thread->SetSchedState(Thread::SCHED_BLOCKED);
+
+	GuestClock::time_point deadline;
+	if (thread->GetWakeDeadline(&deadline))
+		_timers.emplace(deadline, thread);
+}
+
+void StateManager::ReadyThread(Thread* thread)
+{
+	if (thread->GetSchedState() == Thread::SCHED_BLOCKED && thread->CanRun())
+		EnqueueReady(thread);
+}
+
+void StateManager::ExpireTimers()
+{
+	auto now = GuestClock::now();
+	while (!_timers.empty() && _timers.begin()->first <= now) {
+		Thread* thread = _timers.begin()->second;
+		_timers.erase(_timers.begin());
+		// Entries of threads woken early stay behind; ReadyThread ignores them
+		ReadyThread(thread);
+	}
+}
+
+void StateManager::WaitForWork()
+{
+	// Virtual time has nobody to wait for, and turbo skips the wait: jump straight to the next deadline
+	if (!_timers.empty() && (GuestClock::IsVirtual() || _turbo)) {
+		GuestClock::AdvanceTo(_timers.begin()->first);
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(_hostEventMutex);
+	if (_timers.empty())
+		_hostEventCv.wait(lock, [this] { return _hostEventPending; });
+	else
+		_hostEventCv.wait_for(lock, _timers.begin()->first - GuestClock::now(), [this] { return _hostEventPending; });
+	_hostEventPending = false;
+}
+
+void StateManager::NotifyHostEvent()
+{
+	{
+		std::lock_guard<std::mutex> lock(_hostEventMutex);
+		_hostEventPending = true;
+	}
+	_hostEventCv.notify_one();
+}
+
+Thread* StateManager::PickNext(Thread* yielded)
+{
+	while (!_readyQueues.empty()) {
+		Thread* candidate = nullptr;
+
+		// Starvation guard: the longest-waiting queue head runs once it has been ready too long
+		auto starvedBefore = GuestClock::now() - std::chrono::milliseconds(THREAD_STARVATION_MS);
+		for (auto& [priority, queue] : _readyQueues) {
+			Thread* head = queue.front();
+			if (head != yielded && head->GetReadySince() <= starvedBefore && (!candidate || head->GetReadySince() < candidate->GetReadySince()))
+				candidate = head;
+		}
+
+		// Otherwise strict priority, FIFO within a level. A yielding thread gives way to any other
+		// ready thread, including lower priorities, and only runs again if it is alone.
+		for (auto queue = _readyQueues.begin(); !candidate && queue != _readyQueues.end(); ++queue) {
+			for (Thread* thread : queue->second) {
+				if (thread != yielded) {
+					candidate = thread;
+					break;
+				}
+			}
+		}
+		if (!candidate)
+			candidate = yielded;
+
+		RemoveReady(candidate);
+		if (candidate->CanRun())
+			return candidate;
+
+		// Became blocked while queued (e.g. suspended)
+		Park(candidate);
+	}
+	return nullptr;
+}
+
 
+int StateManager::SetThreadPriority(int threadId, uint8_t priority)
+{
+	for (Thread* thread : _threads) {
 		if (thread->GetId() == threadId) {
-			thread->SetPriority(priority);
+			if (thread->GetSchedState() == Thread::SCHED_READY) {
+				RemoveReady(thread);
+				thread->SetPriority(priority);
+				_readyQueues[priority].push_back(thread);
+			}
+			else
+				thread->SetPriority(priority);
 			return 1;
 		}
 	}
 	return NULL;
 }
 
-void StateManager::WakeThread(int threadId)
+void StateManager::BenchmarkContextSwitch(uint32_t iterations)
+{
+	if (iterations == 0)
+		return;
+
+	// Two contexts seeded from the live engine, swapped back and forth as the scheduler would
+	ThreadState first(0, 0, 0), second(0, 0, 0);
+	first.SaveState();
+	second.SaveState();
+
+	auto start = std::chrono::steady_clock::now();
+	for (uint32_t i = 0; i < iterations; i++) {
+		first.SaveState();
+		second.LoadState();
+		second.SaveState();
+		first.LoadState();
+	}
+	auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+	printf("Context switch: %.1f ns (save + restore, %u switches)\n",
+		static_cast<double>(elapsed.count()) / (2.0 * iterations), 2 * iterations);
+}
+
+void StateManager::WakeThread(int threadId, Event* ev)
 {
-	//_currentThread->SaveState();
-	//for (Thread* thread = nullptr; thread != _currentThread; thread = thread->GetNextThread()) {
-	//	if (thread == nullptr)
-	//		thread = _currentThread;
+	{
+		std::lock_guard<std::mutex> lock(_hostEventMutex);
+		_pendingWakes.emplace_back(threadId, ev);
+		_hasPendingWakes = true;
+		_hostEventPending = true;
+	}
+	_hostEventCv.notify_one();
+}
+
+void StateManager::DrainWakeRequests()
+{
+	if (!_hasPendingWakes)
+		return;
+
+	std::vector<std::pair<int, Event*>> wakes;
+	{
+		std::lock_guard<std::mutex> lock(_hostEventMutex);
+		wakes.swap(_pendingWakes);
+		_hasPendingWakes = false;
+	}
 
-	//	if (thread->GetId() == threadId) {
-	//		_currentThread = thread;
-	//		_currentThread->LoadState();
-	//		return;
-	//	}
-	//}
+	for (auto& [threadId, ev] : wakes) {
+		if (Thread* thread = FindThread(threadId))
+			thread->Wake(ev);
+	}
+}
+
+Thread* StateManager::FindThread(int threadId) const
+{
+	for (Thread* thread : _threads) {
+		if (thread->GetId() == threadId)
+			return thread;
+	}
+	return nullptr;
+}
+
+void StateManager::SaveSnapshot(SnapshotWriter& writer) const
+{
+	writer.Write<uint32_t>(static_cast<uint32_t>(_threads.size()));
+	for (Thread* thread : _threads)
+		thread->SaveSnapshot(writer);
+
+	writer.Write<int32_t>(_currentThread ? _currentThread->GetId() : -1);
+	writer.Write<uint8_t>(_idle);
+
+	// Queue order matters for FIFO within a priority level
+	uint32_t readyCount = 0;
+	for (auto& [priority, queue] : _readyQueues)
+		readyCount += static_cast<uint32_t>(queue.size());
+	writer.Write<uint32_t>(readyCount);
+	for (auto& [priority, queue] : _readyQueues) {
+		for (Thread* thread : queue)
+			writer.Write<int32_t>(thread->GetId());
+	}
+}
+
+void StateManager::ClearThreads()
+{
+	// Freeing the stacks would change the heap the restore is about to replace, and unmap large-object
+	// stacks that a changed-pages-only restore expects to find in place
+	for (Thread* thread : _threads) {
+		thread->AbandonStack();
+		delete thread;
+	}
+	_threads.clear();
+	_readyQueues.clear();
+	_timers.clear();
+	_currentThread = nullptr;
+	_idle = false;
+	yielding = false;
+	stateSaved = false;
+
+	std::lock_guard<std::mutex> lock(_hostEventMutex);
+	_pendingWakes.clear();
+	_hasPendingWakes = false;
+}
+
+void StateManager::RestoreSnapshot(SnapshotReader& reader)
+{
+	if (!_threads.empty()) {
+		reader.Fail("threads already running");
+		return;
+	}
+
+	uint32_t threadCount = reader.Read<uint32_t>();
+	for (uint32_t i = 0; i < threadCount && reader.Ok(); i++)
+		_threads.push_back(new Thread(reader));
+
+	int currentId = reader.Read<int32_t>();
+	_currentThread = FindThread(currentId);
+	_idle = reader.Read<uint8_t>() != 0;
+	if (currentId >= 0 && !_currentThread)
+		reader.Fail("unknown current thread");
+
+	uint32_t readyCount = reader.Read<uint32_t>();
+	for (uint32_t i = 0; i < readyCount && reader.Ok(); i++) {
+		Thread* thread = FindThread(reader.Read<int32_t>());
+		if (thread)
+			_readyQueues[thread->GetPriority()].push_back(thread);
+		else
+			reader.Fail("unknown ready thread");
+	}
+
+	// Timer entries are derived state: one per blocked thread with a deadline, as Park would add
+	GuestClock::time_point deadline;
+	for (Thread* thread : _threads) {
+		if (thread->GetSchedState() == Thread::SCHED_BLOCKED && thread->GetWakeDeadline(&deadline))
+			_timers.emplace(deadline, thread);
+	}
 }
 
 
@@ -85,9 +358,14 @@ uint32_t StateManager::GetCurrentThreadQuantum() const
 	return _currentThread->GetTimeQuantum();
 }
 
+uint64_t StateManager::GetCurrentThreadInstructionQuantum() const
+{
+	return _currentThread->GetInstructionQuantum();
+}
+
 bool StateManager::CanCurrentThreadRun()
 {
-	return _currentThread->CanRun();
+	return !_idle && _currentThread->CanRun();
 }
 
 void StateManager::InitCriticalSection(CriticalSection* criticalSection)
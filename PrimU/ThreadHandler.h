@@ -2,9 +2,19 @@
 #define THREAD_HANDLER_H
 
 #include "common.h"
+#include "GuestClock.h"
 #include <queue>
+#include <map>
+#include <vector>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
 
 class Thread;
+class SnapshotWriter;
+class SnapshotReader;
 
 struct CriticalSection
 {
@@ -43,13 +53,47 @@ public:
 	void SaveCurrentThreadState();
 
 	uint32_t GetCurrentThreadQuantum() const;
+	uint64_t GetCurrentThreadInstructionQuantum() const;
 	uint32_t GetCurrentThreadPC();
+	void SetCurrentThreadPC(uint32_t pc);
 	bool CanCurrentThreadRun();
 	int GetCurrentThreadId() const;
+	bool HasThreads() const { return !_threads.empty(); }
+	Thread* FindThread(int threadId) const;
 
 	int SetThreadPriority(int threadId, uint8_t priority);
 
-	void WakeThread(int threadId);
+	// Times save + restore of a thread context on the engine and prints the mean cost per switch
+	void BenchmarkContextSwitch(uint32_t iterations);
+
+	// Ends the thread's wait on `ev`, if it is still waiting on it. Safe to call from any host thread;
+	// the wake is applied on the emulator thread at the next switch.
+	void WakeThread(int threadId, Event* ev);
+	// Called when a blocked thread's wait condition may have cleared (event set, lock handed over, resume)
+	void ReadyThread(Thread* thread);
+
+	// True when every thread is blocked; the executor then calls WaitForWork instead of spinning
+	bool IsIdle() const { return _idle; }
+	// Blocks the host thread until the earliest sleep/wait deadline or until NotifyHostEvent
+	void WaitForWork();
+	// Safe to call from any host thread (input, window)
+	void NotifyHostEvent();
+	void DrainWakeRequests();
+
+	// Machine snapshots: every thread, the current one and the ready queue order. Restoring needs
+	// a scheduler without threads: before Execute, or after ClearThreads.
+	void SaveSnapshot(SnapshotWriter& writer) const;
+	void RestoreSnapshot(SnapshotReader& reader);
+	// Forgets every thread and all scheduling state; only for replacing the machine state. Stacks are
+	// left in the guest heap, which is replaced along with them.
+	void ClearThreads();
+
+	// Number of times a different thread was loaded onto the engine
+	uint64_t GetSwitchCount() const { return _switchCount; }
+
+	// Turbo: when nothing is ready, pending sleeps and timeouts complete at once instead of in real time
+	void SetTurbo(bool enabled) { _turbo = enabled; }
+	bool GetTurbo() const { return _turbo; }
 	void CurrentThreadYield() {
 		yielding = true;
 	}
@@ -67,6 +111,7 @@ public:
 	VirtPtr interruptPC = 0;
 
 	bool yielding = false;
+	bool stateSaved = false;
 
 private:
 	StateManager() {}
@@ -75,7 +120,27 @@ private:
 	void operator=(StateManager const&) = delete;
 	static StateManager* _instance;
 
+	void EnqueueReady(Thread* thread);
+	void RemoveReady(Thread* thread);
+	void Park(Thread* thread);
+	void ExpireTimers();
+	Thread* PickNext(Thread* yielded);
+
 	Thread* _currentThread = nullptr;
+	// Set when no thread was ready at the last switch; _currentThread is then parked, not running
+	bool _idle = false;
+	uint64_t _switchCount = 0;
+
+	std::vector<Thread*> _threads;
+	std::map<uint8_t, std::deque<Thread*>, std::greater<uint8_t>> _readyQueues; // highest priority first
+	std::multimap<GuestClock::time_point, Thread*> _timers; // sleeps and wait timeouts
+
+	std::mutex _hostEventMutex;
+	std::condition_variable _hostEventCv;
+	bool _hostEventPending = false;
+	std::vector<std::pair<int, Event*>> _pendingWakes;
+	std::atomic<bool> _hasPendingWakes = false;
+	std::atomic<bool> _turbo = false;
 };
 
 #define sThreadHandler StateManager::GetInstance()
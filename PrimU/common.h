@@ -50,7 +50,9 @@ enum PRIORITY_LEVELS : uint8_t
 };
 
 #define PAGE_SIZE 0x1000
-#define THREAD_INS 10000
+#define THREAD_INS 10000 // guest instructions per millisecond of thread time quantum
+#define CPSR_THUMB (1u << 5)
+#define THREAD_STARVATION_MS 50 // a ready thread waiting this long runs ahead of higher priorities
 
 #define __check(f, v, e) if (f != v) return e
 #define __CAST(t, v) reinterpret_cast<t>(v)
@@ -9,22 +9,63 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <filesystem>
 #include "PELoader.h"
+#include "Symbols.h"
+
+// Maps one ELF segment. Its file bytes are mapped straight from the file when the segment is page
+// aligned; the zero-initialized rest then gets a block of its own. Otherwise the bytes are copied.
+static ErrorCode LoadSegment(const char* path, const ELFIO::segment* seg)
+{
+    VirtPtr address = static_cast<VirtPtr>(seg->get_virtual_address());
+    size_t size = seg->get_memory_size();
+    size_t fileSize = (std::min)(static_cast<size_t>(seg->get_file_size()), size);
+    uint64_t offset = seg->get_offset();
+
+    if (fileSize && address % PAGE_SIZE == 0 && offset % PAGE_SIZE == 0
+        && sMemoryManager->MapFile(address, path, offset, fileSize) == ERROR_OK) {
+        size_t mapped = (fileSize + PAGE_SIZE - 1) / PAGE_SIZE * PAGE_SIZE;
+        if (size <= mapped) return ERROR_OK;
+
+        ErrorCode err = sMemoryManager->StaticAlloc(address + static_cast<VirtPtr>(mapped), size - mapped);
+        if (err != ERROR_OK) sMemoryManager->StaticFree(address);
+        return err;
+    }
+
+    ErrorCode err;
+    MemoryBlock* memBlock;
+    __check((err = sMemoryManager->StaticAlloc(address, size, &memBlock)), ERROR_OK, err);
+    if (!memBlock) return ERROR_OK;
+
+    RealPtr addr = memBlock->GetRAddr();
+    if (memcpy_s(addr, size, seg->get_data(), fileSize)) {
+        sMemoryManager->StaticFree(address);
+        return ERROR_GENERIC;
+    }
+    return ERROR_OK;
+}
 
 // Load() 的实现
 ErrorCode Executable::Load()
 {
     {
+        // Mapped copy-on-write instead of read and copied: untouched pages stay in the file cache
         std::string kernel(".\\PRIME_OS.ROM");
-        std::vector<uint8_t> _kernelImage;
-        if (!ReadFileToVector(kernel, _kernelImage)) return ERROR_LOADER_READER_FAIL;
+        std::error_code ec;
+        uintmax_t kernelSize = std::filesystem::file_size(kernel, ec);
+        if (ec || kernelSize == 0) return ERROR_LOADER_READER_FAIL;
 
-        ErrorCode err;
-        MemoryBlock* memBlock;
-        __check((err = sMemoryManager->StaticAlloc(0x30000000, _kernelImage.size(), &memBlock)), ERROR_OK, err);
+        if (sMemoryManager->MapFile(0x30000000, kernel, 0, static_cast<size_t>(kernelSize)) != ERROR_OK) {
+            std::vector<uint8_t> _kernelImage;
+            if (!ReadFileToVector(kernel, _kernelImage)) return ERROR_LOADER_READER_FAIL;
 
-        RealPtr addr = memBlock->GetRAddr();
-        (memcpy(addr, _kernelImage.data(), _kernelImage.size()));
+            ErrorCode err;
+            MemoryBlock* memBlock;
+            __check((err = sMemoryManager->StaticAlloc(0x30000000, _kernelImage.size(), &memBlock)), ERROR_OK, err);
+
+            RealPtr addr = memBlock->GetRAddr();
+            (memcpy(addr, _kernelImage.data(), _kernelImage.size()));
+        }
     }
     // 先尝试 ELF（保持原逻辑）
     {
@@ -41,18 +82,28 @@ ErrorCode Executable::Load()
 
                 _address = seg->get_virtual_address();
                 _size = seg->get_memory_size();
-                auto fileSize = seg->get_file_size();
-                auto data = seg->get_data();
 
                 ErrorCode err;
-                MemoryBlock* memBlock;
                 printf("Loading segment %d: VAddr=0x%08X, Size=0x%08X, VEnd=0x%08X\n", i, _address, _size, _address + _size);
-                __check((err = sMemoryManager->StaticAlloc(_address, _size, &memBlock)), ERROR_OK, err);
+                __check((err = LoadSegment(_path, seg)), ERROR_OK, err);
+            }
+
+            // Function symbols for profiles, if the image is not stripped
+            for (ELFIO::Elf_Half i = 0; i < reader.sections.size(); i++)
+            {
+                ELFIO::section* sec = reader.sections[i];
+                if (sec->get_type() != SHT_SYMTAB) continue;
 
-                RealPtr addr = memBlock->GetRAddr();
-                if (memcpy_s(addr, _size, data, fileSize)) {
-                    sMemoryManager->StaticFree(_address);
-                    return ERROR_GENERIC;
+                ELFIO::symbol_section_accessor symbols(reader, sec);
+                for (ELFIO::Elf_Xword j = 0; j < symbols.get_symbols_num(); j++)
+                {
+                    std::string name;
+                    ELFIO::Elf64_Addr value;
+                    ELFIO::Elf_Xword size;
+                    unsigned char bind, type, other;
+                    ELFIO::Elf_Half sectionIndex;
+                    if (symbols.get_symbol(j, name, value, size, bind, type, sectionIndex, other) && type == STT_FUNC)
+                        sSymbols->AddImageSymbol(static_cast<uint32_t>(value), static_cast<uint32_t>(size), name);
                 }
             }
 
@@ -6,11 +6,15 @@
 #include "interrupts.h"
 #include "InterruptHandler.h"
 #include "SystemAPI.h"
+#include "GuestClock.h"
 #include "Thread.h"
 #include "ThreadHandler.h"
+#include "Profiler.h"
+#include "Snapshot.h"
+#include "BlockHistogram.h"
 
+#include <algorithm>
 #include <valarray>
-#include <chrono>
 #include <capstone/capstone.h>
 
 Executor* Executor::m_instance = nullptr;
@@ -20,10 +24,6 @@ Executor* Executor::m_instance = nullptr;
 #define callAndcheckError(f) m_err = f; if (m_err != UC_ERR_OK) return false
 #define DEFINE_INTERRUPT(id, s, n, c) m_interrupts.insert(std::pair<InterruptID, InterruptHandle*>(id, new InterruptHandle(id, s, c, n)))
 
-static bool TryRead32(uc_engine * uc, uint32_t addr, uint32_t * out) {
-	return uc_mem_read(uc, addr, out, sizeof(uint32_t)) == UC_ERR_OK;
-}
-
 static void PrintOneFrame(uc_engine * uc, csh cs, uint32_t addr, int idx) {
 	if (addr == 0) {
 		printf("#%02d 0x%08X\n", idx, addr);
@@ -62,81 +62,23 @@ static void PrintStackTrace(uc_engine * uc) {
 
 	printf("\n--- Stack trace ---\n");
 
+	// 帧 0 为当前 PC，帧 1 为 LR 的调用点，其余来自 R11 帧链（与采样分析器共用）
+	const int MAX_FRAMES = 66;
+	uint32_t frames[MAX_FRAMES];
+	int count = UnwindGuestStack(uc, pc_sanitized, lr, fp, frames, MAX_FRAMES);
+
 	csh handle = 0;
 	cs_mode mode = pc_thumb ? CS_MODE_THUMB : CS_MODE_ARM;
 	if (cs_open(CS_ARCH_ARM, mode, &handle) == CS_ERR_OK) {
 		cs_option(handle, CS_OPT_DETAIL, CS_OPT_OFF);
-
-		int depth = 0;
-
-		// Frame 0: 当前 PC
-		PrintOneFrame(uc, handle, pc_sanitized, depth++);
-
-		// Frame 1: 来自 LR 的返回地址对应“调用点”
-		if (lr) {
-			// 每个地址单独判断是否 Thumb，再决定回退多少字节以指向 BL/BLX
-			bool lr_thumb = is_thumb_addr(lr);
-			uint32_t lr_sanitized = sanitize(lr);
-			uint32_t call_site = lr_sanitized - (lr_thumb ? 2u : 4u);
-			PrintOneFrame(uc, handle, call_site, depth++);
-		}
-
-		// 后续：用 R11 帧链展开（AAPCS 常见布局： [fp-4] = prev_fp, [fp] = saved_lr）
-		const int MAX_FRAMES = 64;
-		uint32_t cur_fp = fp;
-		uint32_t last_fp = 0;
-
-		for (int i = 0; i < MAX_FRAMES; ++i) {
-			if (cur_fp == 0 || cur_fp == last_fp) break;
-
-			uint32_t prev_fp = 0, saved_lr = 0;
-			if (!TryRead32(uc, cur_fp - 4, &prev_fp)) break;
-			if (!TryRead32(uc, cur_fp, &saved_lr)) break;
-
-			if (saved_lr != 0) {
-				bool ret_thumb = is_thumb_addr(saved_lr);
-				uint32_t ret_sanitized = sanitize(saved_lr);
-				uint32_t call_site = ret_sanitized - (ret_thumb ? 2u : 4u);
-				PrintOneFrame(uc, handle, call_site, depth++);
-			}
-
-			last_fp = cur_fp;
-			cur_fp = prev_fp;
-		}
-
+		for (int depth = 0; depth < count; depth++)
+			PrintOneFrame(uc, handle, frames[depth], depth);
 		cs_close(&handle);
 	}
 	else {
 		// Capstone 初始化失败时，退化为仅打印地址
-		int depth = 0;
-		printf("#%02d 0x%08X\n", depth++, pc_sanitized);
-		if (lr) {
-			bool lr_thumb = is_thumb_addr(lr);
-			uint32_t lr_sanitized = sanitize(lr);
-			uint32_t call_site = lr_sanitized - (lr_thumb ? 2u : 4u);
-			printf("#%02d 0x%08X\n", depth++, call_site);
-		}
-
-		const int MAX_FRAMES = 64;
-		uint32_t cur_fp = fp;
-		uint32_t last_fp = 0;
-		for (int i = 0; i < MAX_FRAMES; ++i) {
-			if (cur_fp == 0 || cur_fp == last_fp) break;
-
-			uint32_t prev_fp = 0, saved_lr = 0;
-			if (!TryRead32(uc, cur_fp - 4, &prev_fp)) break;
-			if (!TryRead32(uc, cur_fp, &saved_lr)) break;
-
-			if (saved_lr) {
-				bool ret_thumb = is_thumb_addr(saved_lr);
-				uint32_t ret_sanitized = sanitize(saved_lr);
-				uint32_t call_site = ret_sanitized - (ret_thumb ? 2u : 4u);
-				printf("#%02d 0x%08X\n", depth++, call_site);
-			}
-
-			last_fp = cur_fp;
-			cur_fp = prev_fp;
-		}
+		for (int depth = 0; depth < count; depth++)
+			printf("#%02d 0x%08X\n", depth, frames[depth]);
 	}
 
 	// 附加：栈 dump，便于肉眼搜返回地址
@@ -155,29 +97,8 @@ static void PrintStackTrace(uc_engine * uc) {
 }
 
 void interrupt_hook(uc_engine* uc, uint64_t address, uint32_t size, void* user_data);
-void code_hook(uc_engine* uc, uint64_t address, uint32_t size, void* user_data)
-{
-	static auto lastUpdate = std::chrono::high_resolution_clock::now();
-
-	auto now = std::chrono::high_resolution_clock::now();
-	std::chrono::milliseconds elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - lastUpdate);
-	bool canrun = sThreadHandler->CanCurrentThreadRun();
-	if (sThreadHandler->yielding) {
-		uc_emu_stop(sExecutor->GetUcInstance());
-		sThreadHandler->SaveCurrentThreadState();
-		sThreadHandler->yielding = false;
-		lastUpdate = std::chrono::high_resolution_clock::now();
-		return;
-	}
-	if ((elapsed.count() < sThreadHandler->GetCurrentThreadQuantum() && canrun) ) {
-		return;
-	}
-	uc_emu_stop(sExecutor->GetUcInstance());
-	sThreadHandler->SaveCurrentThreadState();
-
-	//printf(">>> Stopping at 0x%llX, instruction size = 0x%x\n", address, size);
-	lastUpdate = std::chrono::high_resolution_clock::now();
-}
+void stop_hook(uc_engine* uc, uint64_t address, uint32_t size, void* user_data);
+void count_hook(uc_engine* uc, uint64_t address, uint32_t size, void* user_data);
 
 bool Executor::Initialize(Executable* exec)
 {
@@ -194,7 +115,8 @@ bool Executor::Initialize(Executable* exec)
 
 	__check(exec->Load(), ERROR_OK, false);
 
-	__check(sMemoryManager->StaticAlloc(LCD_REGISTER, LCD_REGISTER_SIZE), ERROR_OK, false);
+	// 24MB, of which the firmware touches little; chunks are mapped by pf on first access
+	__check(sMemoryManager->DemandAlloc(LCD_REGISTER, LCD_REGISTER_SIZE), ERROR_OK, false);
 	__check(sMemoryManager->StaticAlloc(0x51000000, 0x44), ERROR_OK, false);
 
 	__check(InitInterrupts(), true, false);
@@ -205,7 +127,12 @@ bool Executor::Initialize(Executable* exec)
 uc_hook m_page_fault;
 uc_hook m_page_fault2;
 uc_hook m_page_fault3;
-void pf(uc_engine* uc, uint64_t address, uint32_t size, void* user_data) {
+bool pf(uc_engine* uc, uc_mem_type type, uint64_t address, int size, int64_t value, void* user_data) {
+	// Demand-paged memory: map the chunk and let Unicorn retry the access. An unaligned access
+	// may fault on its last byte, in the next chunk.
+	if (sMemoryManager->MapDemandChunk(static_cast<VirtPtr>(address)) ||
+		(size > 1 && sMemoryManager->MapDemandChunk(static_cast<VirtPtr>(address + size - 1))))
+		return true;
 
 	uint32_t r0, r1, r2, r3, r4, r5, r6, r7, r8, r9, r10, r11, r12, sp, pc, lr;
 	void* args[16] = { &r0, &r1, &r2, &r3, &r4, &r5, &r6, &r7, &r8, &r9, &r10, &r11, &r12, &sp, &lr, &pc };
@@ -214,7 +141,7 @@ void pf(uc_engine* uc, uint64_t address, uint32_t size, void* user_data) {
 	uc_reg_read_batch(sExecutor->GetUcInstance(), regs, args, 16);
 
 	// __debugbreak();
-	printf("Page fault triggered! \nThread: %i\nRegisters: \n", sThreadHandler->GetCurrentThreadId());
+	printf("Page fault triggered at 0x%08" PRIx64 "! \nThread: %i\nRegisters: \n", address, sThreadHandler->GetCurrentThreadId());
 	printf("    r0: %08X|%i\n    r1: %08X|%i\n    r2: %08X|%i\n    r3: %08X|%i\n    r4: %08X|%i\n"
 		"    r5: %08X|%i\n    r6: %08X|%i\n    r7: %08X|%i\n    r8: %08X|%i\n    r9: %08X|%i\n"
 		"   r10: %08X|%i\n   r11: %08X|%i\n   r12: %08X|%i\n"
@@ -302,11 +229,16 @@ void pf(uc_engine* uc, uint64_t address, uint32_t size, void* user_data) {
 		printf("    Failed to initialize Capstone disassembler.\n");
 	}
 	PrintStackTrace(uc);
+	return false;
 }
 bool Executor::Cleanup()
 {
+	StopPreemptionTimer();
+	if (m_stopHook)
+		callAndcheckError(uc_hook_del(m_uc, m_stopHook));
+	if (m_countHook)
+		callAndcheckError(uc_hook_del(m_uc, m_countHook));
 	callAndcheckError(uc_hook_del(m_uc, m_interrupt_hook));
-	callAndcheckError(uc_hook_del(m_uc, _codeHook));
 	callAndcheckError(uc_hook_del(m_uc, m_page_fault));
 	callAndcheckError(uc_hook_del(m_uc, m_page_fault2));
 	callAndcheckError(uc_hook_del(m_uc, m_page_fault3));
@@ -319,22 +251,178 @@ bool Executor::InitInterrupts()
 {
 	sMemoryManager->StaticAlloc(RTC_REGISTER, 0x100);
 	callAndcheckError(uc_hook_add(m_uc, &m_interrupt_hook, UC_HOOK_INTR, interrupt_hook, this, 0, 1));
-	callAndcheckError(uc_hook_add(m_uc, &_codeHook, UC_HOOK_BLOCK, code_hook, NULL, 1, 0));
 	callAndcheckError(uc_hook_add(m_uc, &m_page_fault, UC_HOOK_MEM_READ_UNMAPPED, pf, 0, 1, 0));
 	callAndcheckError(uc_hook_add(m_uc, &m_page_fault2, UC_HOOK_MEM_WRITE_UNMAPPED, pf, 0, 1, 0));
 	callAndcheckError(uc_hook_add(m_uc, &m_page_fault3, UC_HOOK_MEM_FETCH_UNMAPPED, pf, 0, 1, 0));
 	return true;
 }
+
+void Executor::StartPreemptionTimer()
+{
+	if (m_preemptThread.joinable())
+		return;
+
+	m_preemptExit = false;
+	m_sliceArmed = false;
+	m_preemptThread = std::thread(&Executor::PreemptionTimerProc, this);
+}
+
+void Executor::StopPreemptionTimer()
+{
+	if (!m_preemptThread.joinable())
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(m_preemptMutex);
+		m_preemptExit = true;
+	}
+	m_preemptCv.notify_one();
+	m_preemptThread.join();
+}
+
+void Executor::ArmPreemptionTimer(std::chrono::steady_clock::time_point deadline)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_preemptMutex);
+		m_sliceDeadline = deadline;
+		m_sliceArmed = true;
+	}
+	m_preemptCv.notify_one();
+}
+
+void Executor::DisarmPreemptionTimer()
+{
+	std::lock_guard<std::mutex> lock(m_preemptMutex);
+	m_sliceArmed = false;
+}
+
+void Executor::PreemptionTimerProc()
+{
+	std::unique_lock<std::mutex> lock(m_preemptMutex);
+	while (!m_preemptExit)
+	{
+		if (!m_sliceArmed) {
+			m_preemptCv.wait(lock);
+			continue;
+		}
+
+		if (m_preemptCv.wait_until(lock, m_sliceDeadline) != std::cv_status::timeout || !m_sliceArmed)
+			continue;
+
+		// The stop is lost if it lands before uc_emu_start begins or while a hook rewrites PC,
+		// so keep requesting it until the slice is disarmed
+		uc_emu_stop(m_uc);
+		m_sliceDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(1);
+	}
+}
+
 void Executor::Execute()
 {
-	sThreadHandler->NewThread(m_exec->get_entry(), 0, THREAD_PRIORITY_NORMAL, MEM_STACK_SIZE);
+	// A restored snapshot already brought its threads
+	if (!sThreadHandler->HasThreads())
+		sThreadHandler->NewThread(m_exec->get_entry(), 0, THREAD_PRIORITY_NORMAL, MEM_STACK_SIZE);
 	sThreadHandler->LoadCurrentThreadState();
 
+	if (m_preemptMode == PREEMPT_HOST_TIMER)
+		StartPreemptionTimer();
+	// begin > end hooks every block
+	if (IsCountingInstructions() && !m_countHook)
+		uc_hook_add(m_uc, &m_countHook, UC_HOOK_BLOCK, count_hook, this, 1, 0);
+
+	// Hooks a single address, so only the translation block containing it pays for the callback
+	if (m_hasStopAddress && !m_stopHook)
+		uc_hook_add(m_uc, &m_stopHook, UC_HOOK_CODE, stop_hook, this, m_stopAddress, m_stopAddress);
+
 	m_err = UC_ERR_OK;
 	printf("Starting execution at 0x%X\n\n", sThreadHandler->GetCurrentThreadPC());
-	while (true)
+	std::chrono::steady_clock::time_point sliceDeadline;
+	bool resumeSlice = false;
+	while (!m_stopRequested)
 	{
-		m_err = uc_emu_start(m_uc, sThreadHandler->GetCurrentThreadPC(), 0, 0, 0);
+		// Between slices every thread's registers are in its saved state, so the machine is consistent
+		if (m_snapshotRequested.exchange(false)) {
+			std::string path;
+			{
+				std::lock_guard<std::mutex> lock(m_snapshotMutex);
+				path = m_snapshotPath;
+			}
+			SaveSnapshot(path);
+		}
+		if (m_restoreRequested.exchange(false)) {
+			std::string path;
+			{
+				std::lock_guard<std::mutex> lock(m_snapshotMutex);
+				path = m_restorePath;
+			}
+			// A failed restore leaves the machine half replaced, so it cannot go on
+			if (!RestoreSnapshot(path) || !sThreadHandler->HasThreads()) {
+				printf("Stopping: snapshot %s could not be restored\n", path.c_str());
+				break;
+			}
+			sThreadHandler->LoadCurrentThreadState();
+			resumeSlice = false;
+		}
+		if (m_statsRequested.exchange(false)) {
+			sSystemAPI->DumpStats(stdout);
+			sBlockHistogram->Dump(stdout);
+			sMemoryManager->DumpHeapStats(stdout);
+		}
+		sMemoryManager->PeriodicHeapCheck();
+		sMemoryManager->PeriodicHeapTrim();
+
+		// Blocked threads are skipped here instead of being entered and stopped on their first block
+		if (!sThreadHandler->CanCurrentThreadRun()) {
+			resumeSlice = false;
+			// Nothing ready at all: sleep until the next guest deadline or host input
+			if (sThreadHandler->IsIdle())
+				sThreadHandler->WaitForWork();
+			sThreadHandler->SwitchThread();
+			continue;
+		}
+
+		sThreadHandler->stateSaved = false;
+		if (m_preemptMode == PREEMPT_HOST_TIMER) {
+			// No budget and no hooks: the timer thread stops the engine when the quantum expires
+			if (!resumeSlice)
+				sliceDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(sThreadHandler->GetCurrentThreadQuantum());
+			ArmPreemptionTimer(sliceDeadline);
+			// count_hook, if installed, only counts
+			m_runBudget = UINT64_MAX;
+			m_runInstructions = 0;
+			std::chrono::steady_clock::time_point runStart = std::chrono::steady_clock::now();
+			m_err = uc_emu_start(m_uc, sThreadHandler->GetCurrentThreadPC(), 0, 0, 0);
+			DisarmPreemptionTimer();
+			// No instruction count here, so virtual time moves by the host time the guest ran
+			GuestClock::Credit(std::chrono::steady_clock::now() - runStart);
+		}
+		else {
+			// The time slice is an instruction budget, counted by count_hook once per translation block.
+			// Unicorn's own count would call back for every instruction and cannot be resumed.
+			if (!resumeSlice)
+				m_sliceBudget = sThreadHandler->GetCurrentThreadInstructionQuantum();
+			m_runBudget = m_sliceBudget;
+			m_runInstructions = 0;
+			m_err = uc_emu_start(m_uc, sThreadHandler->GetCurrentThreadPC(), 0, 0, 0);
+			m_sliceBudget -= std::min(m_runInstructions, m_sliceBudget);
+			// Virtual time moves by what actually ran, including slices cut short by a system call
+			GuestClock::Credit(std::chrono::nanoseconds(m_runInstructions * 1000000 / THREAD_INS));
+		}
+		m_executedInstructions += m_runInstructions;
+		resumeSlice = false;
+
+		if (m_err == UC_ERR_OK && !sThreadHandler->stateSaved && !m_stopRequested) {
+			if (sProfiler->ConsumeSampleRequest())
+				sProfiler->Sample(m_uc, sThreadHandler->GetCurrentThreadId());
+			// Stopped with time or budget left, so by a host request (a profile sample, snapshot,
+			// restore or statistics dump) rather than by preemption. The request is served at the top of
+			// the loop and the same thread carries on with the rest of its slice; nothing is credited.
+			bool sliceLeft = m_preemptMode == PREEMPT_HOST_TIMER ? std::chrono::steady_clock::now() < sliceDeadline : m_sliceBudget > 0;
+			if (sliceLeft) {
+				sThreadHandler->SaveCurrentThreadState();
+				resumeSlice = true;
+				continue;
+			}
+		}
 
 		//if (sThreadHandler->interruptPC) {
 		//	printf("interrupt begin PC: %08X\n", sThreadHandler->interruptPC);
@@ -371,6 +459,10 @@ void Executor::Execute()
 			}
 			uc_reg_write(m_uc, UC_ARM_REG_PC, &pc_addr);
 			sThreadHandler->SaveCurrentThreadState();
+		}
+		else if (!sThreadHandler->stateSaved) {
+			// Quantum used up: the engine stopped between translation blocks
+			sThreadHandler->SaveCurrentThreadState();
 		}
 			//break;
 		sThreadHandler->SwitchThread();
@@ -476,29 +568,154 @@ void Executor::Execute()
 	}
 }
 
-void interrupt_hook(uc_engine* uc, uint64_t address, uint32_t size, void* user_data)
+void Executor::RequestStop()
+{
+	m_stopRequested = true;
+	if (m_uc)
+		uc_emu_stop(m_uc);
+	// Also ends an idle wait
+	sThreadHandler->NotifyHostEvent();
+}
+
+void Executor::RequestSnapshot(const std::string& path)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_snapshotMutex);
+		m_snapshotPath = path;
+	}
+	m_snapshotRequested = true;
+	// Pauses the running slice, which resumes afterwards, or ends an idle wait; a lost stop only delays
+	// the snapshot to the next slice
+	if (m_uc)
+		uc_emu_stop(m_uc);
+	sThreadHandler->NotifyHostEvent();
+}
+
+void Executor::RequestRestore(const std::string& path)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_snapshotMutex);
+		m_restorePath = path;
+	}
+	m_restoreRequested = true;
+	if (m_uc)
+		uc_emu_stop(m_uc);
+	sThreadHandler->NotifyHostEvent();
+}
+
+void Executor::RequestStats()
 {
+	// The counters and free lists belong to the emulator thread and are only consistent between slices
+	m_statsRequested = true;
+	if (m_uc)
+		uc_emu_stop(m_uc);
+	sThreadHandler->NotifyHostEvent();
+}
+
+void stop_hook(uc_engine* uc, uint64_t address, uint32_t size, void* user_data)
+{
+	static_cast<Executor*>(user_data)->RequestStop();
+}
+
+void count_hook(uc_engine* uc, uint64_t address, uint32_t size, void* user_data)
+{
+	Executor* executor = static_cast<Executor*>(user_data);
+	executor->m_runInstructions += executor->LookupBlockLength(static_cast<uint32_t>(address), size);
+	// The stop takes effect at the end of this block, as with a budget passed to uc_emu_start
+	if (executor->m_runInstructions >= executor->m_runBudget)
+		uc_emu_stop(uc);
+}
+
+void Executor::FlushCodeCaches()
+{
+	memset(m_svcCache, 0, sizeof(m_svcCache));
+	memset(m_blockCache, 0, sizeof(m_blockCache));
+}
+
+uint32_t Executor::LookupSvcId(uint32_t pc)
+{
+	SvcCacheEntry& entry = m_svcCache[((pc >> 2) ^ (pc >> 12)) & (SVC_CACHE_SIZE - 1)];
+	if (entry.pc == pc)
+		return entry.id;
+
+	uint32_t opcode;
+	const uint32_t* code = reinterpret_cast<const uint32_t*>(sMemoryManager->GetRealAddr(pc - 4));
+	if (code)
+		opcode = *code;
+	else
+		uc_mem_read(m_uc, pc - 4, &opcode, 4);
+
+	entry.pc = pc;
+	entry.id = opcode & 0xFFFFF;
+	return entry.id;
+}
 
-	uint32_t r0, r1, r2, r3, sp, pc, lr;
-	void* args[6] = { &r0, &r1, &r2, &r3, &sp, &pc };
-	int regs[6] = { UC_ARM_REG_R0, UC_ARM_REG_R1, UC_ARM_REG_R2, UC_ARM_REG_R3, UC_ARM_REG_SP, UC_ARM_REG_PC };
+uint32_t Executor::LookupBlockLength(uint32_t address, uint32_t size)
+{
+	BlockCacheEntry& entry = m_blockCache[(address >> 1) & (BLOCK_CACHE_SIZE - 1)];
+	if (entry.address == address && entry.size == size && size)
+		return entry.instructions;
 
+	// First time this block is seen: ARM instructions are all 4 bytes, Thumb ones 2 or 4
+	uint32_t cpsr = 0;
+	uc_reg_read(m_uc, UC_ARM_REG_CPSR, &cpsr);
+	uint32_t instructions = 0;
+	if (!(cpsr & CPSR_THUMB))
+		instructions = size / 4;
+	else {
+		for (uint32_t offset = 0; offset < size; instructions++) {
+			uint16_t halfword = 0;
+			uc_mem_read(m_uc, address + offset, &halfword, 2);
+			// 0b11101, 0b11110 and 0b11111 in the top bits start a 32-bit encoding
+			offset += (halfword >> 11) >= 0x1D ? 4 : 2;
+		}
+	}
 
-	uc_reg_read_batch(uc, regs, args, sizeof(args) / sizeof(void*));
+	entry.address = address;
+	entry.size = size;
+	entry.instructions = instructions ? instructions : 1;
+	return entry.instructions;
+}
 
-	uint32_t SVC;
-	uc_mem_read(uc, pc - 4, &SVC, 4);
-	uc_mem_read(uc, sp, &lr, 4);
+void interrupt_hook(uc_engine* uc, uint64_t address, uint32_t size, void* user_data)
+{
+	Executor* executor = static_cast<Executor*>(user_data);
 
+	uint32_t sp, pc, lr;
+	void* args[2] = { &sp, &pc };
+	int regs[2] = { UC_ARM_REG_SP, UC_ARM_REG_PC };
+	uc_reg_read_batch(uc, regs, args, 2);
 
-	SVC &= 0xFFFFF;
+	uint32_t SVC = executor->LookupSvcId(pc);
 
-	uint32_t return_value = sSystemAPI->Call(static_cast<InterruptID>(SVC), SystemServiceArguments());
+	// The SVC stub pushed the caller's LR; guest stacks are host-backed, so read it in place
+	const uint32_t* stack = reinterpret_cast<const uint32_t*>(sMemoryManager->GetRealAddr(sp));
+	if (stack)
+		lr = *stack;
+	else
+		uc_mem_read(uc, sp, &lr, 4);
+
+	uint32_t return_value = sSystemAPI->Call(static_cast<InterruptID>(SVC), SystemCallFrame{ uc, sp });
 	// printf("    Caller: %08X\n    PC: %08X\n", lr - 4, pc);
 	sp += 8;
 
-	uc_reg_write(uc, UC_ARM_REG_R0, &return_value);
-	uc_reg_write(uc, UC_ARM_REG_SP, &sp);
-	uc_reg_write(uc, UC_ARM_REG_PC, &lr);
+	// System calls are the only points where a thread can yield or block, so the slice ends here.
+	// Writing PC from a hook makes Unicorn drop a pending uc_emu_stop, so a stopping thread gets
+	// its return address through the saved state instead; PC is last in the batch for that reason.
+	if (executor->m_stopSyscall && SVC == executor->m_stopSyscall)
+		executor->m_stopRequested = true;
+
+	bool stopping = sThreadHandler->yielding || !sThreadHandler->CanCurrentThreadRun() || executor->m_stopRequested;
+
+	void* results[3] = { &return_value, &sp, &lr };
+	int resultRegs[3] = { UC_ARM_REG_R0, UC_ARM_REG_SP, UC_ARM_REG_PC };
+	uc_reg_write_batch(uc, resultRegs, results, stopping ? 2 : 3);
+
+	if (stopping) {
+		uc_emu_stop(uc);
+		sThreadHandler->SaveCurrentThreadState();
+		sThreadHandler->SetCurrentThreadPC(lr);
+		sThreadHandler->stateSaved = true;
+	}
 }
 
@@ -7,8 +7,22 @@
 #include "memory.h"
 #include "MemoryManager.h"
 
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <atomic>
+#include <string>
+
 enum InterruptID : uint32_t;
 
+// How a running guest thread is taken off the engine when its quantum is used up
+enum PreemptionMode
+{
+    PREEMPT_INSTRUCTION_COUNT, // instruction budget, counted by a per-block hook
+    PREEMPT_HOST_TIMER         // host thread calls uc_emu_stop when the time quantum expires
+};
+
 class Thread;
 struct InterruptHandle;
 
@@ -25,7 +39,41 @@ public:
     uc_err GetLastError() { return m_err; }
     uc_engine* GetUcInstance() { return m_uc; }
 
+    void SetPreemptionMode(PreemptionMode mode) { m_preemptMode = mode; }
+    PreemptionMode GetPreemptionMode() const { return m_preemptMode; }
+
+    // Must be called whenever guest code is (re)mapped, as cached SVC IDs and block lengths are keyed
+    // by address only
+    void FlushCodeCaches();
+
+    // Makes Execute return at the next opportunity; callable from any host thread
+    void RequestStop();
+    bool IsStopRequested() const { return m_stopRequested; }
+    // Lets Execute run again after it stopped; not while it runs
+    void ClearStopRequest() { m_stopRequested = false; }
+    // Saves a machine snapshot to `path` between two time slices; callable from any host thread
+    void RequestSnapshot(const std::string& path);
+    // Restores the machine from the snapshot at `path` between two time slices and continues from
+    // there; callable from any host thread. Repeated restores of one snapshot, or of snapshots saved
+    // after it, only copy the pages written since. Guest code already translated by Unicorn is
+    // not invalidated, so snapshots of one session should run the same guest code.
+    void RequestRestore(const std::string& path);
+    // Prints the system call statistics, block histogram and heap statistics between two time slices;
+    // callable from any host thread
+    void RequestStats();
+    // Optional stop conditions, set before Execute
+    void SetStopAddress(uint32_t pc) { m_stopAddress = pc; m_hasStopAddress = true; }
+    void SetStopSyscall(uint32_t id) { m_stopSyscall = id; }
+
+    // Counts executed guest instructions with timer preemption as well, at the cost of a callback per
+    // translated block; count preemption always counts them. Set before Execute.
+    void SetCountInstructions(bool count) { m_countInstructions = count; }
+    bool IsCountingInstructions() const { return m_countInstructions || m_preemptMode == PREEMPT_INSTRUCTION_COUNT; }
+    uint64_t GetExecutedInstructions() const { return m_executedInstructions; }
+
     friend void interrupt_hook(uc_engine *uc, uint64_t address, uint32_t size, void *user_data);
+    friend void stop_hook(uc_engine *uc, uint64_t address, uint32_t size, void *user_data);
+    friend void count_hook(uc_engine *uc, uint64_t address, uint32_t size, void *user_data);
 
 private:
     Executor() : m_uc(nullptr)
@@ -33,9 +81,18 @@ private:
     }
     bool InitInterrupts();
 
+    void StartPreemptionTimer();
+    void StopPreemptionTimer();
+    void ArmPreemptionTimer(std::chrono::steady_clock::time_point deadline);
+    void DisarmPreemptionTimer();
+    void PreemptionTimerProc();
+
+    uint32_t LookupSvcId(uint32_t pc);
+    uint32_t LookupBlockLength(uint32_t address, uint32_t size);
+
     static Executor* m_instance;
     uc_engine* m_uc;
-    uc_hook m_interrupt_hook, _codeHook;
+    uc_hook m_interrupt_hook;
     uc_err m_err;
 
     Executable* m_exec;
@@ -45,6 +102,55 @@ private:
     Memory* m_dynamic;
     Memory* m_LCD;
 
+    PreemptionMode m_preemptMode = PREEMPT_HOST_TIMER;
+    std::thread m_preemptThread;
+    std::mutex m_preemptMutex;
+    std::condition_variable m_preemptCv;
+    std::chrono::steady_clock::time_point m_sliceDeadline;
+    bool m_sliceArmed = false;
+    bool m_preemptExit = false;
+
+    // Direct-mapped cache of decoded SVC immediates, keyed by the PC following the SVC
+    static constexpr size_t SVC_CACHE_SIZE = 256;
+    struct SvcCacheEntry
+    {
+        uint32_t pc;
+        uint32_t id;
+    };
+    SvcCacheEntry m_svcCache[SVC_CACHE_SIZE] = {};
+
+    // Direct-mapped cache of instructions per translation block, for the budget of count preemption
+    static constexpr size_t BLOCK_CACHE_SIZE = 4096;
+    struct BlockCacheEntry
+    {
+        uint32_t address;
+        uint32_t size;
+        uint32_t instructions;
+    };
+    BlockCacheEntry m_blockCache[BLOCK_CACHE_SIZE] = {};
+
+    // Count preemption: what is left of the current slice's budget, and what one uc_emu_start ran.
+    // A slice stopped early keeps its remaining budget for when the thread is resumed.
+    uc_hook m_countHook = 0;
+    uint64_t m_sliceBudget = 0;
+    uint64_t m_runBudget = 0;
+    uint64_t m_runInstructions = 0;
+
+    std::atomic<bool> m_stopRequested = false;
+    bool m_hasStopAddress = false;
+    uint32_t m_stopAddress = 0;
+    uint32_t m_stopSyscall = 0; // 0 = none; SDKLIB IDs start at 0x10000
+    uc_hook m_stopHook = 0;
+    bool m_countInstructions = false;
+    uint64_t m_executedInstructions = 0;
+
+    std::atomic<bool> m_snapshotRequested = false;
+    std::atomic<bool> m_restoreRequested = false;
+    std::atomic<bool> m_statsRequested = false;
+    std::mutex m_snapshotMutex;
+    std::string m_snapshotPath;
+    std::string m_restorePath;
+
 
 
 public:
@@ -1,8 +1,11 @@
 #pragma once
 
 #include "stdafx.h"
+#include "SystemCallBinding.h"
 
 class Memory;
+struct SystemTime;
+struct ui_event_prime_s;
 
 void sys_init();
 
@@ -15,30 +18,30 @@ uint32_t _FindResourceW(SystemServiceArguments* args);
 uint32_t _OpenFile(SystemServiceArguments* args);
 uint32_t _LoadLibraryA(SystemServiceArguments* args);
 uint32_t _FreeLibrary(SystemServiceArguments* args); 
-uint32_t GetSysTime(SystemServiceArguments* args);
+uint32_t GetSysTime(GuestPtr<SystemTime> sysTime);
 
-uint32_t _fwrite(SystemServiceArguments* args);
+uint32_t _fwrite(GuestPtr<void> src, uint32_t elementSize, uint32_t count, FileHandle handle);
 
-uint32_t _fclose(SystemServiceArguments* args);
+uint32_t _fclose(FileHandle handle);
 
-uint32_t _filesize(SystemServiceArguments* args);
+uint32_t _filesize(FileHandle handle);
 
-uint32_t _fread(SystemServiceArguments* args);
+uint32_t _fread(GuestPtr<void> dest, uint32_t elementSize, uint32_t count, FileHandle handle);
 
-uint32_t OSSetEvent(SystemServiceArguments* args);
-uint32_t OSCreateEvent(SystemServiceArguments* args);
-uint32_t OSWaitForEvent(SystemServiceArguments* args);
+uint32_t OSSetEvent(uint32_t eventId);
+uint32_t OSCreateEvent(uint32_t manualReset, uint32_t initialState);
+uint32_t OSWaitForEvent(uint32_t eventId, uint32_t timeout);
 uint32_t OSSuspendThread(SystemServiceArguments* args);
 uint32_t OSResumeThread(SystemServiceArguments* args);
 uint32_t SysPowerOff(SystemServiceArguments* args);
 uint32_t LCDOn(SystemServiceArguments* args);
-uint32_t SetSystemVariable(SystemServiceArguments* args);
+uint32_t SetSystemVariable(uint32_t id, uint32_t type, uint32_t value);
 uint32_t GetActiveLCD(SystemServiceArguments* args);
 
-uint32_t lcalloc(SystemServiceArguments* args);
-uint32_t lmalloc(SystemServiceArguments* args);
-uint32_t _lfree(SystemServiceArguments* args);
-uint32_t lrealloc(SystemServiceArguments* args);
+uint32_t lcalloc(uint32_t count, uint32_t size);
+uint32_t lmalloc(uint32_t size);
+uint32_t _lfree(VirtPtr ptr);
+uint32_t lrealloc(VirtPtr ptr, uint32_t new_size);
 
 uint32_t _amkdir(SystemServiceArguments* args);
 uint32_t _achdir(SystemServiceArguments* args);
@@ -47,13 +50,15 @@ uint32_t _wmkdir(SystemServiceArguments* args);
 uint32_t __wfopen(SystemServiceArguments* args);
 
 uint32_t OSCreateThread(SystemServiceArguments* args);
-uint32_t OSSetThreadPriority(SystemServiceArguments* args);
-uint32_t OSInitCriticalSection(SystemServiceArguments* args);
-uint32_t OSEnterCriticalSection(SystemServiceArguments* args);
-uint32_t OSLeaveCriticalSection(SystemServiceArguments* args);
-uint32_t OSSleep(SystemServiceArguments* args); 
+uint32_t OSSetThreadPriority(uint32_t threadId, uint32_t priority);
+uint32_t OSInitCriticalSection(VirtPtr cs);
+uint32_t OSEnterCriticalSection(VirtPtr cs);
+uint32_t OSLeaveCriticalSection(VirtPtr cs);
+uint32_t OSSleep(uint32_t ms);
+uint32_t Delay(uint32_t ms);
+uint32_t PenDelay(uint32_t ms);
 
-uint32_t _GetPrivateProfileString(SystemServiceArguments* args);
+uint32_t _GetPrivateProfileString(GuestPtr<const char> appName, GuestPtr<const char> keyName, GuestPtr<const char> def, GuestPtr<char> outBuf, int size, GuestPtr<const char> filename);
 
 uint32_t _SetPrivateProfileString(SystemServiceArguments* args);
 
@@ -68,7 +73,7 @@ uint32_t _wfindnext(SystemServiceArguments* args);
 
 uint32_t _findclose(SystemServiceArguments* args);
 
-uint32_t GetEvent(SystemServiceArguments* args);
+uint32_t GetEvent(GuestPtr<ui_event_prime_s> eventPtr);
 
 uint32_t GetMasterIDInfo(SystemServiceArguments* args);
 
@@ -78,11 +83,11 @@ uint32_t _aremove(SystemServiceArguments* args);
 
 uint32_t _wremove(SystemServiceArguments* args);
 
-uint32_t CreateFile(SystemServiceArguments* args);
+uint32_t CreateFile(GuestPtr<const char> name);
 
-uint32_t DeviceIoControl(SystemServiceArguments* args);
+uint32_t DeviceIoControl(DeviceHandle handle, uint32_t request, GuestPtr<char> in, uint32_t size, GuestPtr<char> out, int outlen, GuestPtr<uint32_t> retlen, GuestPtr<void> overlapped);
 
-uint32_t CloseHandle(SystemServiceArguments* args);
+uint32_t CloseHandle(DeviceHandle handle);
 
 uint32_t InterruptInitialize(SystemServiceArguments* args);
 
@@ -747,3 +747,6 @@ enum InterruptID : uint32_t
     SDKLIB__MultiByteToWideChar = 0x102E4,
     SDKLIB__WideCharToMultiByte = 0x102E5,
 };
+
+constexpr uint32_t SDKLIB_FIRST = SDKLIB_OSCreateThread;
+constexpr uint32_t SDKLIB_LAST = SDKLIB__WideCharToMultiByte;
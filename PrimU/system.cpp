@@ -8,6 +8,9 @@
 #include "executor.h"
 #include "LCD.h"
 #include "InterruptHandler.h"
+#include "SystemAPI.h"
+#include "Profiler.h"
+#include "BlockHistogram.h"
 #include "ThreadHandler.h"
 #include <string>
 #include <algorithm>
@@ -22,6 +25,8 @@
 #include "handlers.h"
 #include "ui.h"
 #include "Thread.h"
+#include "GuestClock.h"
+#include "Snapshot.h"
 
 namespace fs = std::filesystem;
 
@@ -298,6 +303,8 @@ uint32_t _CloseFile(SystemServiceArguments* args)
 	auto it = g_vfile_table.find(handle);
 	if (it == g_vfile_table.end()) return 0;
 	if (it->second.fp) fclose(it->second.fp);
+	// The entry stays for its path; a cleared fp marks it closed
+	it->second.fp = nullptr;
 	// g_vfile_table.erase(it);
 	return 1;
 }
@@ -318,7 +325,10 @@ uint32_t _ReadFile(SystemServiceArguments* args)
 	void* dest = __GET(void*, destVPtr);
 	if (!dest) return 0;
 
+	// Large reads go straight to the OS, which cannot fault on a write-protected snapshot page
+	sMemoryManager->PrepareHostWrite(destVPtr, size);
 	size_t read = fread(dest, 1, (size_t)size, f);
+	sSystemAPI->AddBytesTransferred(read);
 	return static_cast<uint32_t>(read);
 }
 
@@ -338,8 +348,11 @@ uint32_t _WriteFile(SystemServiceArguments* args)
 	void* src = __GET(void*, srcVPtr);
 	if (!src) return 0;
 
+	// Likewise large writes, which cannot fault in an uncommitted page of a demand-paged region
+	sMemoryManager->PrepareHostRead(srcVPtr, size);
 	size_t wrote = fwrite(src, 1, (size_t)size, f);
 	fflush(f);
+	sSystemAPI->AddBytesTransferred(wrote);
 	return static_cast<uint32_t>(wrote);
 }
 
@@ -565,23 +578,11 @@ uint32_t GetActiveLCD(SystemServiceArguments* args)
 }
 
 // ====== 򵥵 INI ȡ_GetPrivateProfileString ======
-// signature from your code: (r0=dest buffer ptr, r1=appName, r2=keyName, [sp+8]=size, [sp+0xC]=filenamePtr)
-uint32_t _GetPrivateProfileString(SystemServiceArguments* args)
+// (r0=appName, r1=keyName, r2=default, r3=outBuf, [sp+8]=size, [sp+0xC]=filename)
+uint32_t _GetPrivateProfileString(GuestPtr<const char> appName, GuestPtr<const char> keyName, GuestPtr<const char> def, GuestPtr<char> outBuf, int size, GuestPtr<const char> filename)
 {
 	std::call_once(g_init_flag, ensure_prime_drive_roots_initialized);
 
-	const char* appName = __GET(char*, args->r0); // careful: in your original code r0 seemed to be appName earlier - we will follow original print behaviour
-	const char* keyName = __GET(char*, args->r1);
-	const char* def = __GET(char*, args->r2);
-	int size = *__GET(int*, args->sp + 8);
-	VirtPtr filenamePtr = *__GET(VirtPtr*, args->sp + 0xC);
-	const char* filename = __GET(char*, filenamePtr);
-
-	// In your earlier snippet you printed like: __GET(char*, args->r0) was appname,
-	// but typical GetPrivateProfileString signature is (section, key, def, outBuf, size, filename)
-	// To be robust, if the caller follows classic signature, we need to reinterpret:
-	// We'll detect: if appName looks like a path (contains ':' or '\\') -> assume the call passed output buffer differently.
-	// For simplicity here: assume filename is at sp+0xC as earlier, and args->r0 is section name.
 	std::string hostPath = filename ? MapVMPathToHost(filename) : std::string();
 
 	printf("    +appname: %s\n    +keyName: %s\n    +default: %s\n    +size: %i\n    +VM filename: %s\n    +Mapped host path: %s\n",
@@ -661,13 +662,6 @@ uint32_t _GetPrivateProfileString(SystemServiceArguments* args)
 		}
 
 		// write foundValue or default into destination buffer
-		// Note: we must find the destination buffer pointer - typical signature is (section, key, default, outbuf, size, filename)
-		// In your earlier print you used args->r0 etc. To avoid confusion, try to read dest from args->r3 or stack:
-		// We'll try to detect destination pointer in r3 first (commonly used)
-		VirtPtr outBufPtr = args->r3;
-		char* outBuf = nullptr;
-		if (outBufPtr != 0) outBuf = __GET(char*, outBufPtr);
-
 		if (!outBuf) {
 			// fallback: allocate nothing - return length
 			return (uint32_t)(foundValue.empty() ? (def ? strlen(def) : 0) : foundValue.size());
@@ -872,6 +866,7 @@ uint32_t _LoadLibraryA(SystemServiceArguments* args)
 	}
 	PEImage pei;
 	if (LoadPEImage(path, pei, MapVMPathToHost("A:\\WINDOW\\SYSTEM")) == ERROR_OK) {
+		sExecutor->FlushCodeCaches();
 		return pei.actualImageBase;
 	}
 	else {
@@ -891,28 +886,41 @@ uint32_t _FreeLibrary(SystemServiceArguments* args)
 
 std::map<int, std::unique_ptr<CriticalSection>> g_cs;
 
-uint32_t OSInitCriticalSection(SystemServiceArguments* args)
+uint32_t OSInitCriticalSection(VirtPtr cs)
+{
+	g_cs[cs] = std::make_unique<CriticalSection>();
+	return cs;
+}
+
+uint32_t OSEnterCriticalSection(VirtPtr cs)
 {
-	g_cs[args->r0] = std::make_unique<CriticalSection>();
-	return args->r0;
+	sThreadHandler->CurrentThreadEnterCriticalSection(g_cs[cs].get());
+	return cs;
 }
 
-uint32_t OSEnterCriticalSection(SystemServiceArguments* args)
+uint32_t OSLeaveCriticalSection(VirtPtr cs)
 {
-	sThreadHandler->CurrentThreadEnterCriticalSection(g_cs[args->r0].get());
-	return args->r0;
+	sThreadHandler->CurrentThreadExitCriticalSection(g_cs[cs].get());
+	return cs;
 }
 
-uint32_t OSLeaveCriticalSection(SystemServiceArguments* args)
+uint32_t OSSleep(uint32_t ms)
 {
-	sThreadHandler->CurrentThreadExitCriticalSection(g_cs[args->r0].get());
-	return args->r0;
+	sThreadHandler->CurrentThreadSleep(ms);
+	return ms;
 }
 
-uint32_t OSSleep(SystemServiceArguments* args)
+// Busy-wait delays in the firmware; modelled as sleeps so other threads run and turbo can skip them
+uint32_t Delay(uint32_t ms)
 {
-	sThreadHandler->CurrentThreadSleep(args->r0);
-	return args->r0;
+	sThreadHandler->CurrentThreadSleep(ms);
+	return 0;
+}
+
+uint32_t PenDelay(uint32_t ms)
+{
+	sThreadHandler->CurrentThreadSleep(ms);
+	return 0;
 }
 
 struct EVENT
@@ -934,14 +942,14 @@ struct EVENT
 std::map<uint32_t, std::unique_ptr<Event>> g_events;
 uint32_t g_next_event_id = 1;
 // TODO
-uint32_t OSCreateEvent(SystemServiceArguments* args)
+uint32_t OSCreateEvent(uint32_t manualReset, uint32_t initialState)
 {
-	g_events[g_next_event_id] = std::unique_ptr<Event>(sThreadHandler->GetCurrentThread().CreateEvent(args->r0, args->r1));
+	g_events[g_next_event_id] = std::unique_ptr<Event>(sThreadHandler->GetCurrentThread().CreateEvent(manualReset, initialState));
 	return g_next_event_id++;
 }
-uint32_t OSWaitForEvent(SystemServiceArguments* args) {
-	auto& event = *g_events[args->r0];
-	sThreadHandler->GetCurrentThread().WaitForEvent(&event, args->r1);
+uint32_t OSWaitForEvent(uint32_t eventId, uint32_t timeout) {
+	auto& event = *g_events[eventId];
+	sThreadHandler->GetCurrentThread().WaitForEvent(&event, timeout);
 	return 0;
 }
 uint32_t OSSuspendThread(SystemServiceArguments* args) {
@@ -955,13 +963,17 @@ uint32_t OSResumeThread(SystemServiceArguments* args) {
 extern "C" uint32_t ExitProcess(uint32_t);
 
 uint32_t SysPowerOff(SystemServiceArguments* args) {
+	sSystemAPI->DumpStats(stdout);
+	sBlockHistogram->Dump(stdout);
+	sMemoryManager->DumpHeapStats(stdout);
+	sProfiler->Flush();
 	ExitProcess(0);
 	return 0;
 }
 
-uint32_t OSSetEvent(SystemServiceArguments* args)
+uint32_t OSSetEvent(uint32_t eventId)
 {
-	auto& event = *g_events[args->r0];
+	auto& event = *g_events[eventId];
 	sThreadHandler->GetCurrentThread().SetEvent(&event);
 	return 0;
 }
@@ -971,48 +983,50 @@ uint32_t LCDOn(SystemServiceArguments* args)
 	// DUMPARGS;
 	return 0;
 }
-uint32_t SetSystemVariable(SystemServiceArguments* args) {
-	printf("    + sys.var %d (type %d) <- %d\n", args->r0, args->r1, args->r2);
-	if (args->r0 == 6) {
-		if (args->r1 == 2) {
-			sLCDHandler->brightness_level = args->r2;
+uint32_t SetSystemVariable(uint32_t id, uint32_t type, uint32_t value) {
+	printf("    + sys.var %d (type %d) <- %d\n", id, type, value);
+	if (id == 6) {
+		if (type == 2) {
+			sLCDHandler->brightness_level = value;
 		}
 	}
 	return 0;
 }
 
 
-uint32_t lcalloc(SystemServiceArguments* args)
+uint32_t lcalloc(uint32_t count, uint32_t size)
 {
-	//	printf("    +nElements: %i | size: %i\n", args->r0, args->r1);
+	//	printf("    +nElements: %i | size: %i\n", count, size);
 
 	//uint32_t virt_addr = sExecutor->alloc_dynamic_mem(r0*r1);
 	//auto addr = sExecutor->get_from_memory<void>(virt_addr);
 	//memset(addr, 0, r0*r1);
 
+	// calloc semantics: a product that does not fit fails, and the memory reads as zero
+	if (size && count > UINT32_MAX / size)
+		return 0;
+
 	VirtPtr addr;
-	if (sMemoryManager->DyanmicAlloc(&addr, args->r0 * args->r1) == ERROR_OK)
-		return addr;
+	if (sMemoryManager->DyanmicAlloc(&addr, count * size) != ERROR_OK)
+		return 0;
 
-	return 0;
+	memset(sMemoryManager->GetRealAddr(addr), 0, count * size);
+	return addr;
 }
 
-uint32_t lmalloc(SystemServiceArguments* args)
+uint32_t lmalloc(uint32_t size)
 {
-	//printf("    +size: %i\n", args->r0);
+	//printf("    +size: %i\n", size);
 
 	VirtPtr addr;
-	if (sMemoryManager->DyanmicAlloc(&addr, args->r0) == ERROR_OK)
+	if (sMemoryManager->DyanmicAlloc(&addr, size) == ERROR_OK)
 		return addr;
 
 	return 0;
 }
 
-uint32_t lrealloc(SystemServiceArguments* args)
+uint32_t lrealloc(VirtPtr ptr, uint32_t new_size)
 {
-	VirtPtr ptr = args->r0;
-	uint32_t new_size = args->r1;
-
 	if (ptr == 0) {
 		sMemoryManager->DyanmicAlloc(&ptr, new_size);
 		return ptr;
@@ -1024,12 +1038,12 @@ uint32_t lrealloc(SystemServiceArguments* args)
 	return ptr;
 }
 
-uint32_t _lfree(SystemServiceArguments* args)
+uint32_t _lfree(VirtPtr ptr)
 {
 	ErrorCode err;
-	if ((err = sMemoryManager->DynamicFree(args->r0)) != ERROR_OK)
+	if ((err = sMemoryManager->DynamicFree(ptr)) != ERROR_OK)
 		printf("    +error\n");
-	return args->r0;
+	return ptr;
 }
 
 uint32_t OSCreateThread(SystemServiceArguments* args)
@@ -1038,10 +1052,9 @@ uint32_t OSCreateThread(SystemServiceArguments* args)
 	return sThreadHandler->NewThread(args->r0, args->r4);
 }
 
-uint32_t OSSetThreadPriority(SystemServiceArguments* args)
+uint32_t OSSetThreadPriority(uint32_t threadId, uint32_t priority)
 {
-	//DUMPARGS;
-	sThreadHandler->SetThreadPriority(args->r0, args->r1);
+	sThreadHandler->SetThreadPriority(threadId, priority);
 	return 0;
 }
 
@@ -1057,10 +1070,9 @@ struct SystemTime
 	uint16_t Milliseconds;
 };
 
-uint32_t GetSysTime(SystemServiceArguments* args)
+uint32_t GetSysTime(GuestPtr<SystemTime> sysTime)
 {
-	SystemTime* sysTime = __GET(SystemTime*, args->r0);
-	auto now = std::chrono::system_clock::now();
+	auto now = GuestClock::WallNow();
 	auto now_c = std::chrono::system_clock::to_time_t(now);
 	tm* parts = std::localtime(&now_c);
 
@@ -1074,15 +1086,13 @@ uint32_t GetSysTime(SystemServiceArguments* args)
 	auto totalMSec = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
 	sysTime->Milliseconds = static_cast<uint16_t>(totalMSec % 1000);
 
-	return args->r0;
+	return sysTime.addr;
 }
 
 // append-write: _fwrite(handle, srcVirtPtr, size) -> bytes written (append to file end)
-uint32_t _fwrite(SystemServiceArguments* args)
+uint32_t _fwrite(GuestPtr<void> src, uint32_t elementSize, uint32_t count, FileHandle handle)
 {
-	uint32_t handle = args->r3;
-	VirtPtr srcVPtr = args->r0;
-	uint32_t size = (size_t)args->r1 * (size_t)args->r2;
+	uint32_t size = (size_t)elementSize * (size_t)count;
 
 	if (handle == 0 || size == 0) return 0;
 
@@ -1094,7 +1104,6 @@ uint32_t _fwrite(SystemServiceArguments* args)
 
 	printf("    +_fwrite path: %s, size: %u\n", it->second.hostPath.c_str(), size);
 
-	void* src = __GET(void*, srcVPtr);
 	if (!src) return 0;
 
 	//// seek to end for append semantics
@@ -1103,16 +1112,17 @@ uint32_t _fwrite(SystemServiceArguments* args)
 	//	return 0;
 	//}
 
+	sMemoryManager->PrepareHostRead(src.addr, size);
 	size_t wrote = fwrite(src, 1, static_cast<size_t>(size), f);
 	if (wrote > 0) fflush(f);
+	sSystemAPI->AddBytesTransferred(wrote);
 
 	return static_cast<uint32_t>(wrote);
 }
 
 // close: mirror of _CloseFile but named _fclose (returns 1 on success)
-uint32_t _fclose(SystemServiceArguments* args)
+uint32_t _fclose(FileHandle handle)
 {
-	uint32_t handle = args->r0;
 	if (handle == 0) return 0;
 
 	std::lock_guard<std::mutex> lk(g_vfile_mutex);
@@ -1183,9 +1193,8 @@ static bool get_file_size_preserve_pos(FILE* f, uint64_t& out_size, uint64_t& ou
 #endif
 }
 
-uint32_t _filesize(SystemServiceArguments* args)
+uint32_t _filesize(FileHandle handle)
 {
-	uint32_t handle = args->r0;
 	if (handle == 0) return 0;
 
 	std::lock_guard<std::mutex> lk(g_vfile_mutex);
@@ -1202,11 +1211,9 @@ uint32_t _filesize(SystemServiceArguments* args)
 }
 
 // --------- _fread: read from current file pointer into VM memory ----------
-uint32_t _fread(SystemServiceArguments* args)
+uint32_t _fread(GuestPtr<void> dest, uint32_t elementSize, uint32_t count, FileHandle handle)
 {
-	uint32_t handle = args->r3;
-	VirtPtr destVPtr = args->r0;
-	uint32_t size = (size_t)args->r1 * (size_t)args->r2;
+	uint32_t size = (size_t)elementSize * (size_t)count;
 
 	if (handle == 0 || size == 0) return 0;
 
@@ -1216,12 +1223,13 @@ uint32_t _fread(SystemServiceArguments* args)
 	FILE* f = it->second.fp;
 	if (!f) return 0;
 
-	void* dest = __GET(void*, destVPtr);
 	if (!dest) return 0;
 
 	printf("    +_fread path: %s, size: %u\n", it->second.hostPath.c_str(), size);
 
+	sMemoryManager->PrepareHostWrite(dest.addr, size);
 	size_t read = fread(dest, 1, static_cast<size_t>(size), f);
+	sSystemAPI->AddBytesTransferred(read);
 	if (read == 0) {
 		if (feof(f)) {
 			// EOF
@@ -1693,9 +1701,9 @@ uint32_t _wremove(SystemServiceArguments* args)
 }
 static std::unordered_map<uint32_t, std::string> g_vdev_table;
 static uint32_t g_next_dev_handle = 1; // 0 Ϊʧ/Ч
-uint32_t CreateFile(SystemServiceArguments* args) {
-	std::cout << "    +CreateFile_stub name:" << __GET(char*, args->r0) << "\n";
-	g_vdev_table[++g_next_dev_handle] = __GET(char*, args->r0); // Store the device name in the map
+uint32_t CreateFile(GuestPtr<const char> name) {
+	std::cout << "    +CreateFile_stub name:" << name.get() << "\n";
+	g_vdev_table[++g_next_dev_handle] = name.get(); // Store the device name in the map
 	return g_next_dev_handle;
 }
 // Hex dump
@@ -1716,16 +1724,7 @@ static void HexDump(const void* data, size_t size) {
 	std::cout << std::dec; // ָĬʽ
 }
 
-uint32_t DeviceIoControl(SystemServiceArguments* args) {
-	uint32_t handle = args->r0;
-	uint32_t request = args->r1;
-	char* in = __GET(char*, args->r2);
-	uint32_t size = args->r3;
-	char* out = __GET(char*, *__GET(uint32_t*, args->sp + 8));
-	int outlen = *__GET(int*, args->sp + 12);
-	uint32_t* retlen = __GET(uint32_t*, *__GET(int*, args->sp + 16));
-	void* overlapped = __GET(void*, *__GET(int*, args->sp + 20));
-
+uint32_t DeviceIoControl(DeviceHandle handle, uint32_t request, GuestPtr<char> in, uint32_t size, GuestPtr<char> out, int outlen, GuestPtr<uint32_t> retlen, GuestPtr<void> overlapped) {
 
 	//// ӡ ioctl 
 	//std::cout << "    ioctl buffer dump:\n";
@@ -1735,7 +1734,7 @@ uint32_t DeviceIoControl(SystemServiceArguments* args) {
 		return 0; // Invalid handle
 	}
 	if (g_vdev_table[handle].ends_with("BAT")) {
-		auto voltage = (float*)out;
+		auto voltage = reinterpret_cast<float*>(out.get());
 		// TODO: Idk why this works...
 		voltage[0] = voltage[1] = voltage[2] = voltage[3] = 4;
 		return 1;
@@ -1746,8 +1745,7 @@ uint32_t DeviceIoControl(SystemServiceArguments* args) {
 	memset(out, 0xff, outlen); // 
 	return 1; // Simulate success
 }
-uint32_t CloseHandle(SystemServiceArguments* args) {
-	uint32_t handle = args->r0;
+uint32_t CloseHandle(DeviceHandle handle) {
 	if (handle == 0) return 0; // Invalid handle
 	std::cout << "    +CloseHandle_stub handle:" << handle << "\n";
 	auto it = g_vdev_table.find(handle);
@@ -1775,7 +1773,10 @@ uint32_t BatteryLowCheck(SystemServiceArguments* args) {
 	return 0; // Battery OK!
 }
 
-int _ui_thread_id = 0;
+int _ui_thread_id = -1;
+// Never set; GetEvent waits on it with a timeout just to park the UI thread between ticks
+static Event g_inputEvent(false, false);
+static constexpr int GETEVENT_TICK_MS = 50;
 
 std::mutex lock;
 std::vector<UIMultipressEvent> events;
@@ -1784,11 +1785,15 @@ void EnqueueEvent(UIMultipressEvent uime) {
 	std::lock_guard lg(lock);
 	events.push_back(uime);
 
-	sThreadHandler->WakeThread(_ui_thread_id);
+	// Only the GetEvent park is cut short; a UI thread waiting on a firmware event keeps waiting
+	if (_ui_thread_id >= 0)
+		sThreadHandler->WakeThread(_ui_thread_id, &g_inputEvent);
+	else
+		sThreadHandler->NotifyHostEvent();
 }
-uint32_t GetEvent(SystemServiceArguments* args)
+uint32_t GetEvent(GuestPtr<ui_event_prime_s> eventPtr)
 {
-	auto& event = *__GET(ui_event_prime_s*, args->r0);
+	auto& event = *eventPtr.get();
 	event = {}; // ʼ¼ṹ
 
 	std::lock_guard lg(lock); //  events 
@@ -1823,8 +1828,9 @@ uint32_t GetEvent(SystemServiceArguments* args)
 	}
 	else {
 		// û¼߳óȴ¼
+		// The tick is returned now; the thread then sleeps until EnqueueEvent wakes it or the tick elapses
 		_ui_thread_id = sThreadHandler->GetCurrentThreadId();
-		sThreadHandler->CurrentThreadYield();
+		sThreadHandler->GetCurrentThread().WaitForEvent(&g_inputEvent, GETEVENT_TICK_MS);
 	}
 
 	return 0;
@@ -1859,6 +1865,239 @@ uint32_t _GetModuleFileNameA(SystemServiceArguments* args) {
 }
 
 
+// ====== Machine snapshots ======
+// Not saved: UI events still queued (input belongs to the session that produced it) and open
+// FindFirstFile contexts (host directory iterators).
+
+// The static input event has no id in g_events
+static constexpr uint32_t SNAPSHOT_INPUT_EVENT_ID = UINT32_MAX;
+// A waiter queue holds threads, which are restored after these tables
+static std::vector<std::pair<std::deque<Thread*>*, std::vector<int>>> g_snapshotWaiters;
+
+static void SaveWaiters(SnapshotWriter& writer, const std::deque<Thread*>& waiters)
+{
+	writer.Write<uint32_t>(static_cast<uint32_t>(waiters.size()));
+	for (Thread* t : waiters)
+		writer.Write<int32_t>(t->GetId());
+}
+
+static void RestoreWaiters(SnapshotReader& reader, std::deque<Thread*>& waiters)
+{
+	waiters.clear();
+	uint32_t count = reader.Read<uint32_t>();
+	if (count > 0x10000) {
+		reader.Fail("waiter queue too long");
+		count = 0;
+	}
+	std::vector<int> ids(count);
+	for (int& id : ids)
+		id = reader.Read<int32_t>();
+	g_snapshotWaiters.emplace_back(&waiters, std::move(ids));
+}
+
+// Reopening a file must not truncate it, so write modes become update modes
+static std::string ReopenMode(const std::string& mode)
+{
+	std::string out;
+	bool write = false;
+	for (char c : mode) {
+		if (c == 'w') {
+			out += 'r';
+			write = true;
+		}
+		else if (c != 'x')
+			out += c;
+	}
+	if (write && out.find('+') == std::string::npos)
+		out += '+';
+	return out;
+}
+
+void SaveSystemSnapshot(SnapshotWriter& writer)
+{
+	{
+		std::lock_guard<std::mutex> lk(g_vfile_mutex);
+		writer.Write<uint32_t>(g_next_handle);
+		writer.Write<uint32_t>(static_cast<uint32_t>(g_vfile_table.size()));
+		for (auto& [handle, file] : g_vfile_table) {
+			writer.Write<uint32_t>(handle);
+			writer.WriteString(file.hostPath);
+			writer.WriteString(file.mode);
+			// -1 marks a closed handle
+			writer.Write<int64_t>(file.fp ? _ftelli64(file.fp) : -1);
+		}
+	}
+
+	std::call_once(g_init_flag, ensure_prime_drive_roots_initialized);
+	for (auto& cwd : g_cwds)
+		writer.WriteString(cwd);
+	writer.Write<char>(g_currentDrive);
+
+	uint32_t csCount = 0;
+	for (auto& [key, cs] : g_cs)
+		csCount += cs ? 1 : 0;
+	writer.Write<uint32_t>(csCount);
+	for (auto& [key, cs] : g_cs) {
+		if (!cs)
+			continue;
+		writer.Write<uint32_t>(static_cast<uint32_t>(key));
+		writer.Write<uint32_t>(cs->isLocked);
+		writer.Write<int32_t>(cs->ownerHandle);
+		writer.Write<int32_t>(cs->recursionCount);
+		writer.Write<int32_t>(cs->contentionCount);
+		SaveWaiters(writer, cs->waiters);
+	}
+
+	uint32_t eventCount = 0;
+	for (auto& [id, ev] : g_events)
+		eventCount += ev ? 1 : 0;
+	writer.Write<uint32_t>(g_next_event_id);
+	writer.Write<uint32_t>(eventCount);
+	for (auto& [id, ev] : g_events) {
+		if (!ev)
+			continue;
+		writer.Write<uint32_t>(id);
+		writer.Write<uint8_t>(ev->manualReset);
+		writer.Write<uint8_t>(ev->signaled);
+		writer.Write<int32_t>(ev->contentionCount);
+		SaveWaiters(writer, ev->waiters);
+	}
+	writer.Write<uint8_t>(g_inputEvent.signaled);
+	writer.Write<int32_t>(g_inputEvent.contentionCount);
+	SaveWaiters(writer, g_inputEvent.waiters);
+
+	writer.Write<uint32_t>(g_next_dev_handle);
+	writer.Write<uint32_t>(static_cast<uint32_t>(g_vdev_table.size()));
+	for (auto& [handle, name] : g_vdev_table) {
+		writer.Write<uint32_t>(handle);
+		writer.WriteString(name);
+	}
+
+	writer.Write<int32_t>(_ui_thread_id);
+	writer.Write<uint32_t>(struc);
+}
+
+void RestoreSystemSnapshot(SnapshotReader& reader)
+{
+	g_snapshotWaiters.clear();
+
+	{
+		std::lock_guard<std::mutex> lk(g_vfile_mutex);
+		for (auto& [handle, file] : g_vfile_table) {
+			if (file.fp) fclose(file.fp);
+		}
+		g_vfile_table.clear();
+
+		g_next_handle = reader.Read<uint32_t>();
+		uint32_t fileCount = reader.Read<uint32_t>();
+		for (uint32_t i = 0; i < fileCount && reader.Ok(); i++) {
+			uint32_t handle = reader.Read<uint32_t>();
+			VFile file;
+			file.hostPath = reader.ReadString();
+			file.mode = reader.ReadString();
+			int64_t pos = reader.Read<int64_t>();
+			if (pos >= 0 && reader.Ok()) {
+				file.fp = fopen(file.hostPath.c_str(), ReopenMode(file.mode).c_str());
+				if (file.fp)
+					_fseeki64(file.fp, pos, SEEK_SET);
+				else
+					printf("Snapshot: cannot reopen %s, handle %u stays closed\n", file.hostPath.c_str(), handle);
+			}
+			g_vfile_table[handle] = std::move(file);
+		}
+	}
+
+	// Initialize first, so the lazy initialization cannot overwrite the restored directories later
+	std::call_once(g_init_flag, ensure_prime_drive_roots_initialized);
+	for (auto& cwd : g_cwds)
+		cwd = reader.ReadString();
+	g_currentDrive = reader.Read<char>();
+
+	g_cs.clear();
+	uint32_t csCount = reader.Read<uint32_t>();
+	for (uint32_t i = 0; i < csCount && reader.Ok(); i++) {
+		auto& cs = g_cs[static_cast<int>(reader.Read<uint32_t>())];
+		cs = std::make_unique<CriticalSection>();
+		cs->isLocked = reader.Read<uint32_t>();
+		cs->ownerHandle = reader.Read<int32_t>();
+		cs->recursionCount = reader.Read<int32_t>();
+		cs->contentionCount = reader.Read<int32_t>();
+		RestoreWaiters(reader, cs->waiters);
+	}
+
+	g_events.clear();
+	g_next_event_id = reader.Read<uint32_t>();
+	uint32_t eventCount = reader.Read<uint32_t>();
+	for (uint32_t i = 0; i < eventCount && reader.Ok(); i++) {
+		uint32_t id = reader.Read<uint32_t>();
+		bool manualReset = reader.Read<uint8_t>() != 0;
+		bool signaled = reader.Read<uint8_t>() != 0;
+		auto& ev = g_events[id];
+		ev = std::make_unique<Event>(manualReset, signaled);
+		ev->contentionCount = reader.Read<int32_t>();
+		RestoreWaiters(reader, ev->waiters);
+	}
+	g_inputEvent.signaled = reader.Read<uint8_t>() != 0;
+	g_inputEvent.contentionCount = reader.Read<int32_t>();
+	RestoreWaiters(reader, g_inputEvent.waiters);
+
+	g_vdev_table.clear();
+	g_next_dev_handle = reader.Read<uint32_t>();
+	uint32_t devCount = reader.Read<uint32_t>();
+	for (uint32_t i = 0; i < devCount && reader.Ok(); i++) {
+		uint32_t handle = reader.Read<uint32_t>();
+		g_vdev_table[handle] = reader.ReadString();
+	}
+
+	_ui_thread_id = reader.Read<int32_t>();
+	struc = reader.Read<uint32_t>();
+}
+
+void LinkSystemSnapshot()
+{
+	for (auto& [waiters, ids] : g_snapshotWaiters) {
+		for (int id : ids) {
+			if (Thread* thread = sThreadHandler->FindThread(id))
+				waiters->push_back(thread);
+		}
+	}
+	g_snapshotWaiters.clear();
+}
+
+uint32_t GetSnapshotEventId(const Event* ev)
+{
+	if (ev == &g_inputEvent)
+		return SNAPSHOT_INPUT_EVENT_ID;
+	for (auto& [id, event] : g_events) {
+		if (event.get() == ev)
+			return id;
+	}
+	return 0;
+}
+
+Event* FindSnapshotEvent(uint32_t id)
+{
+	if (id == SNAPSHOT_INPUT_EVENT_ID)
+		return &g_inputEvent;
+	auto it = g_events.find(id);
+	return it != g_events.end() ? it->second.get() : nullptr;
+}
+
+uint32_t GetSnapshotCriticalSectionKey(const CriticalSection* cs)
+{
+	for (auto& [key, entry] : g_cs) {
+		if (entry.get() == cs)
+			return static_cast<uint32_t>(key);
+	}
+	return 0;
+}
+
+CriticalSection* FindSnapshotCriticalSection(uint32_t key)
+{
+	auto it = g_cs.find(static_cast<int>(key));
+	return it != g_cs.end() ? it->second.get() : nullptr;
+}
+
 void sys_init() {
 	g_cwds[0] = "A:\\WINDOW\\SYSTEM";
 }
\ No newline at end of file